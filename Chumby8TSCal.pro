@@ -1,6 +1,14 @@
 QT       += core gui
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+# qmake CONFIG+=lite draws through a bare QWindow with built-in text instead
+# of QtWidgets, so the widgets module, styles and fonts are never loaded
+lite {
+    DEFINES += CHUMBY8TSCAL_LITE
+    SOURCES += glyphlabel.cpp litewindow.cpp
+    HEADERS += glyphdata.h glyphlabel.h litewindow.h
+} else {
+    greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+}
 
 CONFIG += c++11
 
@@ -16,13 +24,58 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 SOURCES += \
+    calibrationmath.cpp \
+    calibrationrecord.cpp \
+    calibrationsession.cpp \
+    calibrationtransform.cpp \
     calibrationutils.cpp \
+    calibrator.cpp \
+    capturefile.cpp \
+    devicewatcher.cpp \
+    driftdaemon.cpp \
+    driftestimator.cpp \
+    eventreader.cpp \
+    inputthread.cpp \
+    latencystats.cpp \
     main.cpp \
-    calibrationwindow.cpp
+    processstats.cpp \
+    calibrationwindow.cpp \
+    replay.cpp \
+    sampleaccumulator.cpp \
+    startupprofile.cpp \
+    telemetry.cpp \
+    touchdecoder.cpp \
+    touchscreendevice.cpp \
+    uinputfilter.cpp
 
 HEADERS += \
+    calibrationlayout.h \
+    calibrationmath.h \
+    calibrationoptions.h \
+    calibrationrecord.h \
+    calibrationsession.h \
+    calibrationtransform.h \
     calibrationutils.h \
-    calibrationwindow.h
+    calibrationwindow.h \
+    calibrator.h \
+    capturefile.h \
+    devicewatcher.h \
+    driftdaemon.h \
+    driftestimator.h \
+    eventreader.h \
+    inputthread.h \
+    latencystats.h \
+    processstats.h \
+    replay.h \
+    sampleaccumulator.h \
+    spscqueue.h \
+    startupprofile.h \
+    telemetry.h \
+    touchaxes.h \
+    touchdecoder.h \
+    touchidentity.h \
+    touchscreendevice.h \
+    uinputfilter.h
 
 LIBS += -lX11 -lXi
 
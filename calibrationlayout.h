@@ -0,0 +1,162 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONLAYOUT_H
+#define CALIBRATIONLAYOUT_H
+
+#include <QPoint>
+#include <QSize>
+
+/// Offset (in pixels) from edges of screen to centers of calibration crosshairs
+#define CROSSHAIR_OFFSET                20
+/// Largest number of calibration points supported
+#define MAX_CAL_POINTS                  9
+/// Number of calibration points used unless --points says otherwise; override with DEFINES+=
+#ifndef DEFAULT_CAL_POINTS
+#define DEFAULT_CAL_POINTS              4
+#endif
+
+/// Where a crosshair goes along one axis of the screen
+enum LayoutPosition
+{
+    /// CROSSHAIR_OFFSET in from the left or top edge
+    LayoutNear,
+    /// Halfway across
+    LayoutMiddle,
+    /// CROSSHAIR_OFFSET in from the right or bottom edge
+    LayoutFar
+};
+
+/// Where one crosshair of a layout goes
+struct LayoutPoint
+{
+    LayoutPosition x;
+    LayoutPosition y;
+};
+
+/// Indexes of the corners, which every layout starts with in this order
+enum LayoutCorner
+{
+    TopLeftCorner,
+    TopRightCorner,
+    BottomRightCorner,
+    BottomLeftCorner,
+    NumCorners
+};
+
+/**
+ * @brief Describes a calibration layout: where its crosshairs go and in what order
+ *
+ * The point count is part of the type, so code that's templated on a layout
+ * works on fixed-size arrays that the compiler can unroll.
+ */
+template <int N>
+struct CalibrationLayout
+{
+    enum { NumPoints = N };
+
+    /// The crosshairs, in the order they should be tapped
+    LayoutPoint points[N];
+    /// True to solve for the full affine matrix, false for the four-corner scale and offset
+    bool affine;
+};
+
+/// The classic four corners: scale and offset only
+constexpr CalibrationLayout<4> cornerLayout = {{
+    {LayoutNear, LayoutNear}, {LayoutFar, LayoutNear}, {LayoutFar, LayoutFar}, {LayoutNear, LayoutFar}
+}, false};
+
+/// The corners and the center, for a full affine fit
+constexpr CalibrationLayout<5> fivePointLayout = {{
+    {LayoutNear, LayoutNear}, {LayoutFar, LayoutNear}, {LayoutFar, LayoutFar}, {LayoutNear, LayoutFar},
+    {LayoutMiddle, LayoutMiddle}
+}, true};
+
+/// A 3x3 grid: the corners, then the edge midpoints, then the center
+constexpr CalibrationLayout<9> gridLayout = {{
+    {LayoutNear, LayoutNear}, {LayoutFar, LayoutNear}, {LayoutFar, LayoutFar}, {LayoutNear, LayoutFar},
+    {LayoutMiddle, LayoutNear}, {LayoutFar, LayoutMiddle}, {LayoutMiddle, LayoutFar}, {LayoutNear, LayoutMiddle},
+    {LayoutMiddle, LayoutMiddle}
+}, true};
+
+/**
+ * @brief Checks that a layout starts with the four corners in LayoutCorner order
+ * @param layout The layout
+ * @return True if it does
+ */
+template <int N>
+constexpr bool startsWithCorners(CalibrationLayout<N> const &layout)
+{
+    return N >= NumCorners &&
+           layout.points[TopLeftCorner].x == LayoutNear && layout.points[TopLeftCorner].y == LayoutNear &&
+           layout.points[TopRightCorner].x == LayoutFar && layout.points[TopRightCorner].y == LayoutNear &&
+           layout.points[BottomRightCorner].x == LayoutFar && layout.points[BottomRightCorner].y == LayoutFar &&
+           layout.points[BottomLeftCorner].x == LayoutNear && layout.points[BottomLeftCorner].y == LayoutFar;
+}
+
+static_assert(startsWithCorners(cornerLayout), "The four-corner math depends on the corner order");
+static_assert(startsWithCorners(fivePointLayout), "Every layout has to start with the corners");
+static_assert(startsWithCorners(gridLayout), "Every layout has to start with the corners");
+static_assert(gridLayout.NumPoints <= MAX_CAL_POINTS, "MAX_CAL_POINTS is too small for the largest layout");
+
+/**
+ * @brief Figures out the screen location of one position along an axis
+ * @param position The position
+ * @param length The width or height of the screen in pixels
+ * @return The location in pixels
+ */
+constexpr int layoutCoordinate(LayoutPosition position, int length)
+{
+    return position == LayoutNear ? CROSSHAIR_OFFSET :
+           position == LayoutMiddle ? length / 2 : length - CROSSHAIR_OFFSET;
+}
+
+/**
+ * @brief Figures out where a layout's crosshair goes on the screen
+ * @param point The crosshair
+ * @param screenSize The size of the screen in pixels
+ * @return The center of the crosshair in pixels
+ */
+constexpr QPoint layoutTarget(LayoutPoint const &point, QSize const &screenSize)
+{
+    return QPoint(layoutCoordinate(point.x, screenSize.width()), layoutCoordinate(point.y, screenSize.height()));
+}
+
+/**
+ * @brief A read-only view of the points at the start of some fixed-size storage
+ *
+ * This lets callers go through the points with length(), at() and range-for
+ * without knowing how much room there is for them, or copying them.
+ */
+class PointSpan
+{
+public:
+    constexpr PointSpan(QPoint const *points, int count) : _points(points), _count(count) {}
+
+    int length() const { return _count; }
+    QPoint const &at(int i) const { return _points[i]; }
+    QPoint const &operator[](int i) const { return _points[i]; }
+    QPoint const *begin() const { return _points; }
+    QPoint const *end() const { return _points + _count; }
+
+private:
+    QPoint const *_points;
+    int _count;
+};
+
+#endif // CALIBRATIONLAYOUT_H
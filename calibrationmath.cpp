@@ -0,0 +1,131 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calibrationmath.h"
+#include <cmath>
+
+/// Determinants smaller than this mean the points don't pin down an affine transform
+#define MIN_DETERMINANT                 1e-12
+
+/**
+ * @brief Calculates the determinant of a 3x3 matrix
+ * @param m The matrix, row by row
+ * @return The determinant
+ */
+static double determinant3(double const m[3][3])
+{
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+           m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+           m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+/**
+ * @brief Solves m * x = v for x using Cramer's rule
+ * @param m The 3x3 matrix
+ * @param det The precalculated determinant of m
+ * @param v The right-hand side
+ * @param x Filled in with the solution
+ */
+static void solve3(double const m[3][3], double det, double const v[3], double x[3])
+{
+    for (int col = 0; col < 3; col++) {
+        double replaced[3][3];
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++) {
+                replaced[r][c] = (c == col) ? v[r] : m[r][c];
+            }
+        }
+        x[col] = determinant3(replaced) / det;
+    }
+}
+
+/**
+ * @brief Solves the normal equations shared by both rows of an affine fit
+ * @param ata A^T A for rows of [rawX rawY 1]
+ * @param atbX A^T b for the screen X coordinates
+ * @param atbY A^T b for the screen Y coordinates
+ * @param matrix Filled in with the 3x3 libinput calibration matrix (row by row)
+ * @return True on success, false if the points don't determine a transform
+ */
+bool CalibrationMath::solveNormalEquations(double const ata[3][3], double const atbX[3], double const atbY[3],
+                                           float matrix[9])
+{
+    double const det = determinant3(ata);
+    if (std::fabs(det) < MIN_DETERMINANT) {
+        return false;
+    }
+
+    double rowX[3];
+    double rowY[3];
+    solve3(ata, det, atbX, rowX);
+    solve3(ata, det, atbY, rowY);
+
+    for (int i = 0; i < 3; i++) {
+        matrix[i] = static_cast<float>(rowX[i]);
+        matrix[3 + i] = static_cast<float>(rowY[i]);
+    }
+    matrix[6] = 0.0f;
+    matrix[7] = 0.0f;
+    matrix[8] = 1.0f;
+    return true;
+}
+
+/**
+ * @brief Figures out where on the screen a calibration matrix puts a raw touchscreen sample
+ * @param matrix The 3x3 libinput calibration matrix (row by row)
+ * @param raw The raw touchscreen sample
+ * @param axes The raw ranges of the touchscreen axes
+ * @param screenSize The size of the screen in pixels
+ * @return The screen location in pixels
+ */
+QPointF CalibrationMath::mapToScreen(float const matrix[9], QPoint const &raw,
+                                     TouchAxes const &axes, QSize const &screenSize)
+{
+    double const nx = axes.x.normalize(raw.x());
+    double const ny = axes.y.normalize(raw.y());
+    return QPointF((matrix[0] * nx + matrix[1] * ny + matrix[2]) * screenSize.width(),
+                   (matrix[3] * nx + matrix[4] * ny + matrix[5]) * screenSize.height());
+}
+
+/**
+ * @brief Figures out which raw touchscreen location a calibration matrix maps to a screen location
+ * @param matrix The 3x3 libinput calibration matrix (row by row)
+ * @param screen The screen location in pixels
+ * @param axes The raw ranges of the touchscreen axes
+ * @param screenSize The size of the screen in pixels
+ * @param rawX Filled in with the raw X value
+ * @param rawY Filled in with the raw Y value
+ * @return True on success, false if the matrix can't be inverted
+ */
+bool CalibrationMath::mapToRaw(float const matrix[9], QPoint const &screen,
+                               TouchAxes const &axes, QSize const &screenSize, float &rawX, float &rawY)
+{
+    double const a = matrix[0], b = matrix[1], c = matrix[2];
+    double const d = matrix[3], e = matrix[4], f = matrix[5];
+    double const det = a * e - b * d;
+    if (std::fabs(det) < MIN_DETERMINANT || screenSize.isEmpty()) {
+        return false;
+    }
+
+    // Invert the 2x2 part, after taking the translation back out
+    double const sx = static_cast<double>(screen.x()) / screenSize.width() - c;
+    double const sy = static_cast<double>(screen.y()) / screenSize.height() - f;
+    rawX = static_cast<float>(axes.x.denormalize((e * sx - b * sy) / det));
+    rawY = static_cast<float>(axes.y.denormalize((a * sy - d * sx) / det));
+    return true;
+}
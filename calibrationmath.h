@@ -0,0 +1,115 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONMATH_H
+#define CALIBRATIONMATH_H
+
+#include <QPoint>
+#include <QPointF>
+#include <QSize>
+#include <array>
+#include <cmath>
+#include <stddef.h>
+#include "touchaxes.h"
+
+/**
+ * @brief Math for turning calibration samples into a libinput calibration matrix
+ *
+ * Everything here works on caller-supplied fixed-size arrays; nothing allocates.
+ * The least squares fit is templated on the number of points, so each layout
+ * gets its own fully unrolled copy.
+ */
+class CalibrationMath
+{
+public:
+    template <size_t N>
+    static bool solveAffine(std::array<QPoint, N> const &raw, std::array<QPoint, N> const &screen,
+                            TouchAxes const &axes, QSize const &screenSize,
+                            float matrix[9], std::array<float, N> &residuals);
+    static QPointF mapToScreen(float const matrix[9], QPoint const &raw,
+                               TouchAxes const &axes, QSize const &screenSize);
+    static bool mapToRaw(float const matrix[9], QPoint const &screen,
+                         TouchAxes const &axes, QSize const &screenSize, float &rawX, float &rawY);
+
+private:
+    static bool solveNormalEquations(double const ata[3][3], double const atbX[3], double const atbY[3],
+                                     float matrix[9]);
+};
+
+/**
+ * @brief Finds the full affine calibration matrix that best fits a set of samples (least squares)
+ * @param raw The raw touchscreen reading at each calibration point
+ * @param screen The screen location (in pixels) of each calibration point
+ * @param axes The raw ranges of the touchscreen axes
+ * @param screenSize The size of the screen in pixels
+ * @param matrix Filled in with the 3x3 libinput calibration matrix (row by row)
+ * @param residuals Filled in with each point's remaining error in pixels
+ * @return True on success, false if the points don't determine a transform
+ *
+ * N has to be at least 3, and the points can't all be in a line.
+ *
+ * libinput applies the matrix to raw coordinates normalized to 0...1 using the
+ * axis ranges the driver reports, and expects screen coordinates normalized to
+ * 0...1 back, so the fit is done in those units: screenX = a*rawX + b*rawY + c
+ * and screenY = d*rawX + e*rawY + f. Both rows share the same normal equations,
+ * so only one 3x3 system has to be set up.
+ */
+template <size_t N>
+bool CalibrationMath::solveAffine(std::array<QPoint, N> const &raw, std::array<QPoint, N> const &screen,
+                                  TouchAxes const &axes, QSize const &screenSize,
+                                  float matrix[9], std::array<float, N> &residuals)
+{
+    static_assert(N >= 3, "An affine fit needs at least three points");
+    if (axes.x.span() <= 0 || axes.y.span() <= 0 || screenSize.isEmpty()) {
+        return false;
+    }
+
+    double const widthD = static_cast<double>(screenSize.width());
+    double const heightD = static_cast<double>(screenSize.height());
+
+    // Accumulate the normal equations (A^T A) and (A^T b) for rows [rawX rawY 1]
+    double ata[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+    double atbX[3] = {0, 0, 0};
+    double atbY[3] = {0, 0, 0};
+    for (size_t i = 0; i < N; i++) {
+        double const row[3] = {axes.x.normalize(raw[i].x()), axes.y.normalize(raw[i].y()), 1.0};
+        double const sx = screen[i].x() / widthD;
+        double const sy = screen[i].y() / heightD;
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++) {
+                ata[r][c] += row[r] * row[c];
+            }
+            atbX[r] += row[r] * sx;
+            atbY[r] += row[r] * sy;
+        }
+    }
+
+    if (!solveNormalEquations(ata, atbX, atbY, matrix)) {
+        return false;
+    }
+
+    // Figure out how far off each point still is, in pixels
+    for (size_t i = 0; i < N; i++) {
+        QPointF const error = mapToScreen(matrix, raw[i], axes, screenSize) - screen[i];
+        residuals[i] = static_cast<float>(std::sqrt(error.x() * error.x() + error.y() * error.y()));
+    }
+
+    return true;
+}
+
+#endif // CALIBRATIONMATH_H
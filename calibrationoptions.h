@@ -0,0 +1,71 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONOPTIONS_H
+#define CALIBRATIONOPTIONS_H
+
+#include <QString>
+#include "calibrationutils.h"
+#include "calibrator.h"
+#include "telemetry.h"
+
+/**
+ * @brief Settings for a calibration run, filled in from the command line
+ */
+struct CalibrationOptions
+{
+    CalibrationOptions() :
+        inputThread(false),
+        fullScan(false),
+        exclusive(false),
+        calibrationPoints(DEFAULT_CAL_POINTS),
+        verify(false),
+        scripted(false),
+        tapTolerance(0),
+        telemetryLimit(TELEMETRY_DEFAULT_LIMIT)
+    {
+    }
+
+    /// Read and decode the touchscreen on a dedicated thread instead of the GUI thread
+    bool inputThread;
+    /// Find the touchscreen by opening every input device instead of using sysfs
+    bool fullScan;
+    /// Grab the touchscreen so X doesn't also process every touch while calibrating
+    bool exclusive;
+    /// Number of crosshairs to tap: 4 (corners only), 5 (plus center) or 9 (3x3 grid)
+    int calibrationPoints;
+    /// Which samples of each tap are used for calibrating
+    PressureGate pressureGate;
+    /// After calibrating, let the user draw on the screen to check the result before saving
+    bool verify;
+    /// Driven by a test fixture: targets and results go to stdout, commands come from stdin,
+    /// and the calibration is saved without waiting for a confirming tap
+    bool scripted;
+    /// If not empty, every raw touchscreen event is saved to this capture file
+    QString recordFile;
+    /// If not empty, these imported calibrations are checked with one tap instead of calibrating
+    QList<DeviceCalibration> profile;
+    /// Largest error (in pixels) that the check tap is allowed to have
+    float tapTolerance;
+    /// If not empty, a telemetry record for each touchscreen is appended to this file on exit
+    QString telemetryFile;
+    /// Size (in bytes) the telemetry file can grow to before it's rotated
+    qint64 telemetryLimit;
+};
+
+#endif // CALIBRATIONOPTIONS_H
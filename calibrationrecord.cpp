@@ -0,0 +1,235 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calibrationrecord.h"
+#include <fcntl.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Identifies a calibration record
+#define CALIBRATION_RECORD_MAGIC        "C8TC"
+/// Current version of the calibration record
+#define CALIBRATION_RECORD_VERSION      2
+/// The original version, without the physical path and unique ID
+#define CALIBRATION_RECORD_VERSION_1    1
+/// Size of a version 1 record, whose checksum came right after deviceVersion
+#define CALIBRATION_RECORD_SIZE_1       72
+
+static_assert(sizeof(CalibrationRecord) == 136, "CalibrationRecord must not contain padding");
+static_assert(offsetof(CalibrationRecord, phys) + sizeof(quint32) == CALIBRATION_RECORD_SIZE_1,
+              "Version 2 must only add fields to version 1");
+
+/**
+ * @brief Assembles a calibration record, ready to be saved
+ * @param matrix The 3x3 calibration matrix (9 floats)
+ * @param axes The raw ranges of the touchscreen it was calibrated with
+ * @param identity The identity of the touchscreen it was calibrated with
+ * @return The record's bytes, or an empty array if the matrix is the wrong size
+ */
+QByteArray CalibrationRecordFile::build(QVector<float> const &matrix, TouchAxes const &axes,
+                                        TouchIdentity const &identity)
+{
+    if (matrix.length() != 9) {
+        return QByteArray();
+    }
+
+    CalibrationRecord record;
+    memset(&record, 0, sizeof(record));
+    memcpy(record.magic, CALIBRATION_RECORD_MAGIC, sizeof(record.magic));
+    record.version = CALIBRATION_RECORD_VERSION;
+    record.size = sizeof(record);
+    for (int i = 0; i < 9; i++) {
+        record.matrix[i] = matrix[i];
+    }
+    record.xMinimum = axes.x.minimum;
+    record.xMaximum = axes.x.maximum;
+    record.yMinimum = axes.y.minimum;
+    record.yMaximum = axes.y.maximum;
+    record.busType = identity.id.bustype;
+    record.vendor = identity.id.vendor;
+    record.product = identity.id.product;
+    record.deviceVersion = identity.id.version;
+    memcpy(record.phys, identity.phys, sizeof(record.phys));
+    memcpy(record.uniq, identity.uniq, sizeof(record.uniq));
+    record.phys[sizeof(record.phys) - 1] = 0;
+    record.uniq[sizeof(record.uniq) - 1] = 0;
+    record.checksum = crc32(&record, offsetof(CalibrationRecord, checksum));
+
+    return QByteArray(reinterpret_cast<char const *>(&record), sizeof(record));
+}
+
+/**
+ * @brief Checks one record from a file, converting it from version 1 if needed
+ * @param data The record's bytes
+ * @param length The number of bytes available
+ * @param record Filled in with the record
+ * @return The size of the record in the file, or 0 if it's invalid
+ */
+static size_t parseRecord(unsigned char const *data, size_t length, CalibrationRecord &record)
+{
+    if (length < CALIBRATION_RECORD_SIZE_1) {
+        return 0;
+    }
+
+    memcpy(&record, data, CALIBRATION_RECORD_SIZE_1);
+    if (memcmp(record.magic, CALIBRATION_RECORD_MAGIC, sizeof(record.magic))) {
+        return 0;
+    }
+
+    if (record.version == CALIBRATION_RECORD_VERSION_1 && record.size == CALIBRATION_RECORD_SIZE_1) {
+        // The old checksum sits where the new fields start
+        quint32 checksum;
+        memcpy(&checksum, data + offsetof(CalibrationRecord, phys), sizeof(checksum));
+        if (checksum != CalibrationRecordFile::crc32(data, offsetof(CalibrationRecord, phys))) {
+            return 0;
+        }
+        memset(record.phys, 0, sizeof(record.phys));
+        memset(record.uniq, 0, sizeof(record.uniq));
+        record.checksum = checksum;
+        return CALIBRATION_RECORD_SIZE_1;
+    }
+
+    if (record.version != CALIBRATION_RECORD_VERSION || record.size != sizeof(record) ||
+        length < sizeof(record)) {
+        return 0;
+    }
+    memcpy(&record, data, sizeof(record));
+    if (record.checksum != CalibrationRecordFile::crc32(&record, offsetof(CalibrationRecord, checksum))) {
+        return 0;
+    }
+    return sizeof(record);
+}
+
+/**
+ * @brief Loads and validates a saved calibration record file
+ * @param path The record file
+ * @param records Filled in with the records, one per touchscreen
+ * @param maxRecords The most records the file is allowed to hold
+ * @return True if the file was read and every record in it is valid, false otherwise
+ *
+ * This is meant for the boot-time path, so it sticks to plain system calls.
+ */
+bool CalibrationRecordFile::load(char const *path, QVector<CalibrationRecord> &records, int maxRecords)
+{
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    size_t const length = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    if (length > 0 && length <= static_cast<size_t>(maxRecords) * sizeof(CalibrationRecord)) {
+        data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        qCritical("Unable to read calibration record %s", path);
+        return false;
+    }
+
+    records.clear();
+    unsigned char const *bytes = static_cast<unsigned char const *>(data);
+    size_t offset = 0;
+    bool ok = true;
+    while (ok && offset < length) {
+        CalibrationRecord record;
+        size_t const size = parseRecord(bytes + offset, length - offset, record);
+        if (size == 0) {
+            ok = false;
+        } else {
+            records.append(record);
+            offset += size;
+        }
+    }
+    munmap(data, length);
+
+    if (!ok) {
+        qCritical("Calibration record %s is invalid", path);
+        records.clear();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Determines whether a record was made for a touchscreen
+ * @param record The record
+ * @param identity The touchscreen's identity
+ * @return True if the record is for this touchscreen
+ *
+ * An empty physical path or unique ID in the record matches anything. Version
+ * 1 records don't have either, so they match anything with the same EVIOCGID.
+ */
+bool CalibrationRecordFile::matches(CalibrationRecord const &record, TouchIdentity const &identity)
+{
+    return record.busType == identity.id.bustype && record.vendor == identity.id.vendor &&
+           record.product == identity.id.product && record.deviceVersion == identity.id.version &&
+           (!record.phys[0] || !strncmp(record.phys, identity.phys, sizeof(record.phys))) &&
+           (!record.uniq[0] || !strncmp(record.uniq, identity.uniq, sizeof(record.uniq)));
+}
+
+/**
+ * @brief Finds the record that best fits a touchscreen
+ * @param records The records to look through
+ * @param identity The touchscreen's identity
+ * @return The index of the matching record, or -1 if none match
+ *
+ * If more than one matches, the most specific one wins, so a record for one
+ * particular panel takes priority over one for every panel in its batch.
+ */
+int CalibrationRecordFile::find(QVector<CalibrationRecord> const &records, TouchIdentity const &identity)
+{
+    int best = -1;
+    int bestScore = -1;
+    for (int i = 0; i < records.length(); i++) {
+        if (!matches(records[i], identity)) {
+            continue;
+        }
+        int const score = (records[i].uniq[0] ? 2 : 0) + (records[i].phys[0] ? 1 : 0);
+        if (score > bestScore) {
+            best = i;
+            bestScore = score;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Calculates the standard (zlib/PNG) CRC-32 of some data
+ * @param data The data
+ * @param length The number of bytes
+ * @return The CRC
+ */
+quint32 CalibrationRecordFile::crc32(void const *data, size_t length)
+{
+    // The record is tiny, so a lookup table wouldn't be worth its setup
+    unsigned char const *bytes = static_cast<unsigned char const *>(data);
+    quint32 crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,85 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONRECORD_H
+#define CALIBRATIONRECORD_H
+
+#include <QByteArray>
+#include <QVector>
+#include <QtGlobal>
+#include <linux/input.h>
+#include "touchaxes.h"
+#include "touchidentity.h"
+
+/// Most touchscreens a calibration record file can hold
+#define MAX_CALIBRATION_RECORDS         8
+/// Most records a calibration profile can hold (one per panel serial number, say)
+#define MAX_PROFILE_RECORDS             1024
+
+/**
+ * @brief Binary copy of the saved calibration, for applying it quickly at boot
+ *
+ * The Xorg config snippet is the calibration that really matters, but it's
+ * text and awkward to read back. This record is saved next to it with the
+ * same matrix, plus the axis ranges and identity of the touchscreen it was
+ * made for, and a CRC-32 of everything before the checksum. It's fixed-size and
+ * in the Chumby's native (little-endian) byte order, so loading it is just
+ * mapping the file and checking a few fields.
+ *
+ * The file holds one record per touchscreen, back to back. Version 1 records
+ * didn't have the physical path and unique ID, and only one was ever saved;
+ * they're still accepted, and match any touchscreen with the same EVIOCGID.
+ *
+ * Calibration profiles for provisioning are files of these records too. A
+ * record whose unique ID has been cleared matches every panel of that kind,
+ * so the same file can hold a batch-wide default and per-serial overrides.
+ */
+struct CalibrationRecord
+{
+    char magic[4];
+    quint16 version;
+    quint16 size;
+    float matrix[9];
+    qint32 xMinimum;
+    qint32 xMaximum;
+    qint32 yMinimum;
+    qint32 yMaximum;
+    quint16 busType;
+    quint16 vendor;
+    quint16 product;
+    quint16 deviceVersion;
+    char phys[TOUCH_IDENTITY_STRING_SIZE];
+    char uniq[TOUCH_IDENTITY_STRING_SIZE];
+    quint32 checksum;
+};
+
+/**
+ * @brief Creates and validates CalibrationRecords
+ */
+class CalibrationRecordFile
+{
+public:
+    static QByteArray build(QVector<float> const &matrix, TouchAxes const &axes, TouchIdentity const &identity);
+    static bool load(char const *path, QVector<CalibrationRecord> &records,
+                     int maxRecords = MAX_CALIBRATION_RECORDS);
+    static bool matches(CalibrationRecord const &record, TouchIdentity const &identity);
+    static int find(QVector<CalibrationRecord> const &records, TouchIdentity const &identity);
+    static quint32 crc32(void const *data, size_t length);
+};
+
+#endif // CALIBRATIONRECORD_H
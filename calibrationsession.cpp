@@ -0,0 +1,339 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calibrationsession.h"
+#include "calibrationutils.h"
+#include <string.h>
+#include <X11/Xatom.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XInput.h>
+
+/// Name of the X11 input device property containing the calibration matrix
+#define LIBINPUT_CALIBRATION_PROPERTY   "libinput Calibration Matrix"
+/// Name of the X11 input device property containing the USB-style vendor and product IDs
+#define PRODUCT_ID_PROPERTY             "Device Product ID"
+/// Name of the X11 input device property containing the evdev node the device reads from
+#define DEVICE_NODE_PROPERTY            "Device Node"
+/// Number of atoms looked up when opening a session
+#define NUM_SESSION_ATOMS               4
+
+/**
+ * @brief The X11 state held by a CalibrationSession
+ */
+struct CalibrationSessionPrivate
+{
+    QByteArray devicePath;
+    Display *display;
+    XDevice *device;
+    Atom matrixAtom;
+    Atom floatAtom;
+    Atom productIdAtom;
+};
+
+/// Displays of all open sessions, which share one installed error handler
+static QVector<Display *> sessionDisplays;
+/// The error handler that was installed before ours (likely by Qt)
+static XErrorHandler previousErrorHandler = nullptr;
+/// Display on which the most recent session error occurred
+static Display *lastErrorDisplay = nullptr;
+/// Request serial number of the most recent session error
+static unsigned long lastErrorSerial = 0;
+
+/**
+ * @brief Error handler installed for as long as any session is open
+ * @param display The display the error occurred on
+ * @param err Info about the error
+ * @return Anything; ignored by Xlib
+ *
+ * Xlib only reports errors from XChangeDeviceProperty through the global error
+ * handler, so we note which request failed and let apply() compare it against
+ * the request it made. Errors on displays that aren't ours go to the previous handler.
+ */
+static int calibrationSessionErrorHandler(Display *display, XErrorEvent *err)
+{
+    if (!sessionDisplays.contains(display)) {
+        return previousErrorHandler ? previousErrorHandler(display, err) : 0;
+    }
+
+    lastErrorDisplay = display;
+    lastErrorSerial = err->serial;
+    return 0;
+}
+
+/**
+ * @brief Constructor for CalibrationSession. Doesn't connect to X until open() or apply().
+ * @param devicePath The evdev node of the touchscreen to calibrate, such as
+ *        /dev/input/event1. If empty, the first touchscreen X knows about is used.
+ */
+CalibrationSession::CalibrationSession(QString const &devicePath) :
+    _d(new CalibrationSessionPrivate)
+{
+    _d->devicePath = devicePath.toUtf8();
+    _d->display = nullptr;
+    _d->device = nullptr;
+    _d->matrixAtom = None;
+    _d->floatAtom = None;
+    _d->productIdAtom = None;
+}
+
+/**
+ * @brief Destructor for CalibrationSession
+ */
+CalibrationSession::~CalibrationSession()
+{
+    close();
+    delete _d;
+}
+
+/**
+ * @brief Connects to X and looks up everything needed to change the calibration
+ * @return True on success, false on failure
+ */
+bool CalibrationSession::open()
+{
+    if (isOpen()) {
+        return true;
+    }
+
+    // We are going to talk to the X server to modify the touchscreen's
+    // calibration matrix property live.
+    _d->display = XOpenDisplay(nullptr);
+    if (!_d->display) {
+        // Couldn't open the display; something failed.
+        return false;
+    }
+
+    // Our error handler stays installed for as long as any session is open
+    if (sessionDisplays.isEmpty()) {
+        previousErrorHandler = XSetErrorHandler(calibrationSessionErrorHandler);
+    }
+    sessionDisplays.append(_d->display);
+
+    // We need to find the touchscreen's device in X. Get a list of all of them.
+    // More than one can have the same name, so keep all of the candidates.
+    int deviceCount;
+    QVector<XID> candidates;
+    XDeviceInfo *devices = XListInputDevices(_d->display, &deviceCount);
+    if (devices) {
+        for (int i = 0; i < deviceCount; i++) {
+            if (devices[i].name && !strcmp(devices[i].name, CHUMBY_TOUCHSCREEN_NAME)) {
+                candidates.append(devices[i].id);
+            }
+        }
+        XFreeDeviceList(devices);
+    }
+
+    // Look up all of the atoms in a single round trip. Passing only_if_exists means
+    // we'll get None back if libinput isn't driving the device.
+    char *atomNames[NUM_SESSION_ATOMS] = {
+        const_cast<char *>(LIBINPUT_CALIBRATION_PROPERTY),
+        // "float" properties don't seem to be built into X11, so grab the atom representing them
+        const_cast<char *>("FLOAT"),
+        // Only used for checking saved records; fine if it's missing
+        const_cast<char *>(PRODUCT_ID_PROPERTY),
+        // Only used for picking between several touchscreens
+        const_cast<char *>(DEVICE_NODE_PROPERTY)
+    };
+    Atom atoms[NUM_SESSION_ATOMS] = {None, None, None, None};
+    if (!candidates.isEmpty()) {
+        XInternAtoms(_d->display, atomNames, NUM_SESSION_ATOMS, true, atoms);
+    }
+    _d->matrixAtom = atoms[0];
+    _d->floatAtom = atoms[1];
+    _d->productIdAtom = atoms[2];
+    Atom const deviceNodeAtom = atoms[3];
+
+    if (_d->matrixAtom != None && _d->floatAtom != None) {
+        for (int i = 0; !_d->device && i < candidates.length(); i++) {
+            _d->device = XOpenDevice(_d->display, candidates[i]);
+            if (_d->device && !_d->devicePath.isEmpty() && !isDeviceNode(deviceNodeAtom)) {
+                XCloseDevice(_d->display, _d->device);
+                _d->device = nullptr;
+            }
+        }
+    }
+
+    if (!_d->device) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks whether the device that was just opened reads from the requested evdev node
+ * @param deviceNodeAtom The atom for the device node property
+ * @return True if it does, or if there's no device node property to go by and
+ *         this is the only choice there will be; false otherwise
+ */
+bool CalibrationSession::isDeviceNode(unsigned long deviceNodeAtom) const
+{
+    if (deviceNodeAtom == None) {
+        // Without the property, there's no telling them apart
+        return true;
+    }
+
+    Atom type;
+    int format;
+    unsigned long count, remaining;
+    unsigned char *data = nullptr;
+    bool matches = false;
+    if (XGetDeviceProperty(_d->display, _d->device, deviceNodeAtom, 0, 256, False, XA_STRING,
+                           &type, &format, &count, &remaining, &data) == Success && data) {
+        matches = type == XA_STRING && format == 8 &&
+                  QByteArray(reinterpret_cast<char const *>(data), static_cast<int>(count)) == _d->devicePath;
+        XFree(data);
+    }
+    return matches;
+}
+
+/**
+ * @brief Releases the device and disconnects from X
+ */
+void CalibrationSession::close()
+{
+    if (!_d->display) {
+        return;
+    }
+
+    if (_d->device) {
+        XCloseDevice(_d->display, _d->device);
+        _d->device = nullptr;
+    }
+
+    // Any errors still in flight belong to us, so let them arrive before
+    // the previous handler is put back
+    XSync(_d->display, False);
+    XCloseDisplay(_d->display);
+    if (lastErrorDisplay == _d->display) {
+        lastErrorDisplay = nullptr;
+    }
+    sessionDisplays.removeOne(_d->display);
+    _d->display = nullptr;
+
+    if (sessionDisplays.isEmpty()) {
+        XSetErrorHandler(previousErrorHandler);
+        previousErrorHandler = nullptr;
+    }
+}
+
+/**
+ * @brief Determines whether the session is connected to the touchscreen in X
+ * @return True if open
+ */
+bool CalibrationSession::isOpen() const
+{
+    return _d->device != nullptr;
+}
+
+/**
+ * @brief Applies a calibration matrix to the touchscreen, opening the session if needed
+ * @param matrix The new 3x3 calibration matrix for libinput (9 floats: top row, middle row, bottom row sequentially)
+ * @return True on success, false on failure
+ */
+bool CalibrationSession::apply(float const *matrix)
+{
+    if (!open()) {
+        return false;
+    }
+
+    // Remember which request is ours so that we can tell whether an error
+    // reported during the sync below belongs to it
+    unsigned long const serial = NextRequest(_d->display);
+    XChangeDeviceProperty(_d->display, _d->device, _d->matrixAtom, _d->floatAtom, 32, PropModeReplace,
+                          reinterpret_cast<const unsigned char *>(matrix), 9);
+    XSync(_d->display, False);
+
+    if (lastErrorDisplay == _d->display && lastErrorSerial >= serial) {
+        // Something went wrong; start from scratch next time in case the
+        // device went away and came back with a different ID
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Applies a calibration matrix to the touchscreen, opening the session if needed
+ * @param matrix The new 3x3 calibration matrix for libinput (top row, middle row, bottom row sequentially)
+ * @return True on success, false on failure
+ */
+bool CalibrationSession::apply(QVector<float> const &matrix)
+{
+    // Ensure there are exactly 9 entries in the calibration matrix
+    if (matrix.length() != 9) {
+        return false;
+    }
+
+    return apply(matrix.constData());
+}
+
+/**
+ * @brief Applies a saved calibration record, as long as it was made for this touchscreen
+ * @param record The record, already validated by CalibrationRecordFile::load()
+ * @return True on success, false if it's for a different device or applying it failed
+ *
+ * The vendor and product are checked against the device's product ID property
+ * when the driver provides one. If it doesn't, there's nothing to check against,
+ * so the record is trusted.
+ */
+bool CalibrationSession::apply(CalibrationRecord const &record)
+{
+    if (!open()) {
+        return false;
+    }
+
+    if (_d->productIdAtom != None) {
+        Atom type;
+        int format;
+        unsigned long count, remaining;
+        unsigned char *data = nullptr;
+        if (XGetDeviceProperty(_d->display, _d->device, _d->productIdAtom, 0, 2, False, XA_INTEGER,
+                               &type, &format, &count, &remaining, &data) == Success && data) {
+            // Format 32 properties come back as an array of longs
+            long const *ids = reinterpret_cast<long const *>(data);
+            bool const mismatch = type == XA_INTEGER && format == 32 && count == 2 &&
+                                  (ids[0] != record.vendor || ids[1] != record.product);
+            XFree(data);
+            if (mismatch) {
+                qCritical("Saved calibration record is for a different touchscreen");
+                return false;
+            }
+        }
+    }
+
+    return apply(record.matrix);
+}
+
+/**
+ * @brief Looks up the size of the screen the touchscreen is mapped onto, opening the session if needed
+ * @return The size in pixels, or an empty size if X can't be reached
+ *
+ * This is for callers without a Qt GUI that still need to work in screen pixels.
+ */
+QSize CalibrationSession::screenSize()
+{
+    if (!open()) {
+        return QSize();
+    }
+
+    int const screen = DefaultScreen(_d->display);
+    return QSize(DisplayWidth(_d->display, screen), DisplayHeight(_d->display, screen));
+}
@@ -0,0 +1,64 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONSESSION_H
+#define CALIBRATIONSESSION_H
+
+#include <QSize>
+#include <QString>
+#include <QVector>
+#include "calibrationrecord.h"
+
+struct CalibrationSessionPrivate;
+
+/**
+ * @brief A reusable connection to X for pushing calibration matrices to the touchscreen
+ *
+ * Opening the session finds the touchscreen's X input device and looks up the
+ * atoms needed to change its calibration once. After that, every apply() is a
+ * single property change plus one XSync round trip to find out whether it
+ * worked, so it's cheap enough to call repeatedly for live previews.
+ *
+ * When there's more than one touchscreen, give the session the evdev node of
+ * the one it's for; X devices are matched to it by their "Device Node" property.
+ */
+class CalibrationSession
+{
+public:
+    CalibrationSession(QString const &devicePath = QString());
+    ~CalibrationSession();
+
+    bool open();
+    void close();
+    bool isOpen() const;
+
+    bool apply(float const *matrix);
+    bool apply(QVector<float> const &matrix);
+    bool apply(CalibrationRecord const &record);
+
+    QSize screenSize();
+
+private:
+    Q_DISABLE_COPY(CalibrationSession)
+
+    bool isDeviceNode(unsigned long deviceNodeAtom) const;
+
+    CalibrationSessionPrivate *_d;
+};
+
+#endif // CALIBRATIONSESSION_H
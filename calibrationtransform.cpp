@@ -0,0 +1,190 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calibrationtransform.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CALIBRATION_TRANSFORM_NEON
+#endif
+
+/// Number of fractional bits in the fixed-point coefficients and results
+#define FIXED_POINT_SHIFT               16
+
+/**
+ * @brief Converts a coefficient to Q16.16, saturating if it doesn't fit
+ * @param value The coefficient
+ * @return The fixed-point coefficient
+ */
+static qint32 toFixed(double value)
+{
+    double const scaled = value * (1 << FIXED_POINT_SHIFT);
+    if (scaled >= 2147483647.0) {
+        return 2147483647;
+    }
+    if (scaled <= -2147483648.0) {
+        return -2147483647 - 1;
+    }
+    return static_cast<qint32>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+/**
+ * @brief Constructs an identity transform that leaves raw values alone
+ */
+CalibrationTransform::CalibrationTransform() :
+    _xx(1), _xy(0), _x0(0),
+    _yx(0), _yy(1), _y0(0),
+    _fixedXX(1 << FIXED_POINT_SHIFT), _fixedXY(0), _fixedX0(0),
+    _fixedYX(0), _fixedYY(1 << FIXED_POINT_SHIFT), _fixedY0(0)
+{
+}
+
+/**
+ * @brief Constructor for CalibrationTransform
+ * @param matrix The 3x3 libinput calibration matrix (row by row)
+ * @param axes The raw ranges of the touchscreen axes
+ * @param screenSize The size of the screen in pixels
+ */
+CalibrationTransform::CalibrationTransform(float const matrix[9], TouchAxes const &axes, QSize const &screenSize)
+{
+    // The matrix works on normalized coordinates: n = (raw - min) / span on the
+    // way in, and pixels = n * size on the way out. Fold all of that together.
+    double const width = screenSize.width();
+    double const height = screenSize.height();
+    double const spanX = axes.x.span();
+    double const spanY = axes.y.span();
+    double const xx = width * matrix[0] / spanX;
+    double const xy = width * matrix[1] / spanY;
+    double const x0 = width * (matrix[2] - matrix[0] * axes.x.minimum / spanX - matrix[1] * axes.y.minimum / spanY);
+    double const yx = height * matrix[3] / spanX;
+    double const yy = height * matrix[4] / spanY;
+    double const y0 = height * (matrix[5] - matrix[3] * axes.x.minimum / spanX - matrix[4] * axes.y.minimum / spanY);
+
+    _xx = static_cast<float>(xx);
+    _xy = static_cast<float>(xy);
+    _x0 = static_cast<float>(x0);
+    _yx = static_cast<float>(yx);
+    _yy = static_cast<float>(yy);
+    _y0 = static_cast<float>(y0);
+
+    _fixedXX = toFixed(xx);
+    _fixedXY = toFixed(xy);
+    _fixedX0 = toFixed(x0);
+    _fixedYX = toFixed(yx);
+    _fixedYY = toFixed(yy);
+    _fixedY0 = toFixed(y0);
+}
+
+/**
+ * @brief Transforms a single raw sample
+ * @param raw The raw touchscreen sample
+ * @return The screen location in pixels
+ */
+QPointF CalibrationTransform::map(QPoint const &raw) const
+{
+    return QPointF(_xx * raw.x() + _xy * raw.y() + _x0,
+                   _yx * raw.x() + _yy * raw.y() + _y0);
+}
+
+/**
+ * @brief Transforms an array of raw samples, using SIMD if it's available
+ * @param rawX The raw X values
+ * @param rawY The raw Y values
+ * @param count The number of samples
+ * @param screenX Filled in with the screen X locations in pixels
+ * @param screenY Filled in with the screen Y locations in pixels
+ */
+void CalibrationTransform::transform(int const *rawX, int const *rawY, int count, float *screenX, float *screenY) const
+{
+    int i = 0;
+#if defined(__SSE2__)
+    __m128 const xx = _mm_set1_ps(_xx), xy = _mm_set1_ps(_xy), x0 = _mm_set1_ps(_x0);
+    __m128 const yx = _mm_set1_ps(_yx), yy = _mm_set1_ps(_yy), y0 = _mm_set1_ps(_y0);
+    for (; i + 4 <= count; i += 4) {
+        __m128 const x = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(rawX + i)));
+        __m128 const y = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(rawY + i)));
+        _mm_storeu_ps(screenX + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, x), _mm_mul_ps(xy, y)), x0));
+        _mm_storeu_ps(screenY + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(yx, x), _mm_mul_ps(yy, y)), y0));
+    }
+#elif defined(CALIBRATION_TRANSFORM_NEON)
+    float32x4_t const x0 = vdupq_n_f32(_x0), y0 = vdupq_n_f32(_y0);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t const x = vcvtq_f32_s32(vld1q_s32(rawX + i));
+        float32x4_t const y = vcvtq_f32_s32(vld1q_s32(rawY + i));
+        vst1q_f32(screenX + i, vmlaq_n_f32(vmlaq_n_f32(x0, x, _xx), y, _xy));
+        vst1q_f32(screenY + i, vmlaq_n_f32(vmlaq_n_f32(y0, x, _yx), y, _yy));
+    }
+#endif
+
+    // Whatever's left over (or everything, without SIMD)
+    transformScalar(rawX + i, rawY + i, count - i, screenX + i, screenY + i);
+}
+
+/**
+ * @brief Transforms an array of raw samples one at a time in floating point
+ * @param rawX The raw X values
+ * @param rawY The raw Y values
+ * @param count The number of samples
+ * @param screenX Filled in with the screen X locations in pixels
+ * @param screenY Filled in with the screen Y locations in pixels
+ */
+void CalibrationTransform::transformScalar(int const *rawX, int const *rawY, int count, float *screenX, float *screenY) const
+{
+    for (int i = 0; i < count; i++) {
+        float const x = static_cast<float>(rawX[i]);
+        float const y = static_cast<float>(rawY[i]);
+        screenX[i] = _xx * x + _xy * y + _x0;
+        screenY[i] = _yx * x + _yy * y + _y0;
+    }
+}
+
+/**
+ * @brief Transforms an array of raw samples without using any floating point
+ * @param rawX The raw X values
+ * @param rawY The raw Y values
+ * @param count The number of samples
+ * @param screenX Filled in with the screen X locations in Q16.16 pixels
+ * @param screenY Filled in with the screen Y locations in Q16.16 pixels
+ */
+void CalibrationTransform::transformFixed(int const *rawX, int const *rawY, int count, qint32 *screenX, qint32 *screenY) const
+{
+    // A 32x32->64 bit multiply is a single instruction (smull) even on ARMv5
+    for (int i = 0; i < count; i++) {
+        qint64 const x = rawX[i];
+        qint64 const y = rawY[i];
+        screenX[i] = static_cast<qint32>(_fixedXX * x + _fixedXY * y + _fixedX0);
+        screenY[i] = static_cast<qint32>(_fixedYX * x + _fixedYY * y + _fixedY0);
+    }
+}
+
+/**
+ * @brief Names the SIMD instruction set used by transform()
+ * @return The name, or "none" if transform() is plain C++
+ */
+char const *CalibrationTransform::simdName()
+{
+#if defined(__SSE2__)
+    return "SSE2";
+#elif defined(CALIBRATION_TRANSFORM_NEON)
+    return "NEON";
+#else
+    return "none";
+#endif
+}
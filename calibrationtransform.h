@@ -0,0 +1,64 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATIONTRANSFORM_H
+#define CALIBRATIONTRANSFORM_H
+
+#include <QPoint>
+#include <QPointF>
+#include <QSize>
+#include <QtGlobal>
+#include "touchaxes.h"
+
+/**
+ * @brief Applies a calibration matrix to raw touchscreen samples, in bulk
+ *
+ * The matrix, the raw axis normalization and the scaling to screen pixels are
+ * all folded together up front into screen = A * raw + B. Samples are passed
+ * in structure-of-arrays form (one array of X values, one of Y) so the loops
+ * vectorize. There are three versions of the loop:
+ *
+ * - transform(): floating point, using SSE2 or NEON when the compiler targets them
+ * - transformScalar(): floating point, one sample at a time, for comparison
+ * - transformFixed(): Q16.16 fixed point with no floating point at all, for
+ *   processors without an FPU like the Chumby 8's
+ */
+class CalibrationTransform
+{
+public:
+    CalibrationTransform();
+    CalibrationTransform(float const matrix[9], TouchAxes const &axes, QSize const &screenSize);
+
+    QPointF map(QPoint const &raw) const;
+    void transform(int const *rawX, int const *rawY, int count, float *screenX, float *screenY) const;
+    void transformScalar(int const *rawX, int const *rawY, int count, float *screenX, float *screenY) const;
+    void transformFixed(int const *rawX, int const *rawY, int count, qint32 *screenX, qint32 *screenY) const;
+
+    static char const *simdName();
+
+private:
+    // screenX = _xx * rawX + _xy * rawY + _x0 (and the same for Y), in pixels
+    float _xx, _xy, _x0;
+    float _yx, _yy, _y0;
+
+    // The same coefficients in Q16.16
+    qint32 _fixedXX, _fixedXY, _fixedX0;
+    qint32 _fixedYX, _fixedYY, _fixedY0;
+};
+
+#endif // CALIBRATIONTRANSFORM_H
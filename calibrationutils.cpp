@@ -17,234 +17,554 @@
  */
 
 #include "calibrationutils.h"
+#include "calibrationsession.h"
 #include <QString>
 #include <QDir>
+#include <QFile>
+#include <QElapsedTimer>
 #include <linux/input.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <string.h>
 #include <unistd.h>
-#include <X11/Xlib.h>
-#include <X11/extensions/XInput.h>
 
-/// The name to look for in order to identify the touchscreen
-#define CHUMBY_TOUCHSCREEN_NAME         "Chumby 8 touchscreen"
 /// File used for storing touchscreen calibration
 #define CALIBRATION_FILE                "/mnt/settings/touchscreen.conf"
-/// Name of the X11 input device property containing the calibration matrix
-#define LIBINPUT_CALIBRATION_PROPERTY   "libinput Calibration Matrix"
+/// Binary copy of the calibration, for applying it quickly at boot
+#define CALIBRATION_RECORD_FILE         "/mnt/settings/touchscreen.cal"
+/// File used for remembering where the touchscreen was found last time
+#define TOUCHSCREEN_PATH_CACHE_FILE     "/mnt/settings/touchscreen.device"
+/// Directory in sysfs describing all input devices
+#define SYSFS_INPUT_CLASS_DIR           "/sys/class/input"
 
-/// Keeps track of whether we received an error from X11
-static volatile int xErrorOccurred = false;
+/**
+ * @brief Opens an input device, but only if it's the touchscreen
+ * @param path The path to the device node, such as /dev/input/event0
+ * @return The file descriptor if it's the touchscreen, or -1 if not
+ */
+int CalibrationUtils::openTouchScreen(QString const &path)
+{
+    int fd = ::open(path.toUtf8().constData(), O_RDONLY | O_NONBLOCK);
+    if (fd > 0) {
+        char name[32];
+        if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) >= 0) {
+            // Ensure it's null-terminated to be safe
+            name[sizeof(name)-1] = 0;
+        } else {
+            name[0] = 0;
+        }
+
+        // If we found it, return it
+        if (!::strncmp(name, CHUMBY_TOUCHSCREEN_NAME, sizeof(name))) {
+            return fd;
+        }
+
+        // Otherwise, close it
+        ::close(fd);
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Reads one axis range from the touchscreen
+ * @param fd The touchscreen's file descriptor
+ * @param code The single-touch axis (ABS_X or ABS_Y)
+ * @param mtCode The equivalent multitouch axis, tried if the single-touch one isn't there
+ * @param axis Filled in with the range, or left alone on failure
+ * @return True on success, false if the device didn't report a usable range
+ */
+static bool readAxis(int fd, int code, int mtCode, AxisInfo &axis)
+{
+    input_absinfo info;
+    if (ioctl(fd, EVIOCGABS(code), &info) < 0 || info.maximum <= info.minimum) {
+        if (ioctl(fd, EVIOCGABS(mtCode), &info) < 0 || info.maximum <= info.minimum) {
+            return false;
+        }
+    }
+
+    axis.minimum = info.minimum;
+    axis.maximum = info.maximum;
+    axis.fuzz = info.fuzz;
+    axis.resolution = info.resolution;
+    return true;
+}
 
 /**
- * @brief Custom error handler for Xlib during touchscreen calibration
- * @param display The display the error occurred on
- * @param err Info about the error
- * @return Anything; ignored by Xlib
+ * @brief Asks the touchscreen driver for the range of each axis
+ * @param fd The touchscreen's file descriptor
+ * @param axes Filled in with the ranges. An axis the driver doesn't report keeps
+ *        its default of 0 to RAW_TOUCHSCREEN_RANGE.
+ * @return True if both axes were read, false if a default had to be used
  */
-static int touchScreenCalibrationErrorHandler(Display *display, XErrorEvent *err)
+bool CalibrationUtils::readTouchAxes(int fd, TouchAxes &axes)
 {
-    Q_UNUSED(display);
-    Q_UNUSED(err);
+    bool const haveX = readAxis(fd, ABS_X, ABS_MT_POSITION_X, axes.x);
+    bool const haveY = readAxis(fd, ABS_Y, ABS_MT_POSITION_Y, axes.y);
+    if (!haveX || !haveY) {
+        qCritical("Unable to read the touchscreen's axis ranges, assuming 0-%d", RAW_TOUCHSCREEN_RANGE);
+        return false;
+    }
+
+    qDebug("Touchscreen axes: X %d-%d (fuzz %d, %d/mm), Y %d-%d (fuzz %d, %d/mm)",
+           axes.x.minimum, axes.x.maximum, axes.x.fuzz, axes.x.resolution,
+           axes.y.minimum, axes.y.maximum, axes.y.fuzz, axes.y.resolution);
+    return true;
+}
+
+/**
+ * @brief Reads a string from the touchscreen driver
+ * @param fd The touchscreen's file descriptor
+ * @param request The ioctl request, like EVIOCGPHYS(size)
+ * @param buffer Filled in with the string, or empty on failure
+ * @param size The size of the buffer
+ */
+static void readDeviceString(int fd, unsigned long request, char *buffer, size_t size)
+{
+    memset(buffer, 0, size);
+    if (ioctl(fd, request, buffer) < 0) {
+        buffer[0] = 0;
+    }
+    buffer[size - 1] = 0;
+}
+
+/**
+ * @brief Asks the touchscreen driver who the device is
+ * @param fd The touchscreen's file descriptor
+ * @param identity Filled in with the bus type, vendor, product, version, physical
+ *        path and unique ID. Anything the driver doesn't have is left zeroed.
+ * @return True if at least the IDs were read, false on failure
+ */
+bool CalibrationUtils::readDeviceIdentity(int fd, TouchIdentity &identity)
+{
+    identity = TouchIdentity();
+    readDeviceString(fd, EVIOCGPHYS(sizeof(identity.phys)), identity.phys, sizeof(identity.phys));
+    readDeviceString(fd, EVIOCGUNIQ(sizeof(identity.uniq)), identity.uniq, sizeof(identity.uniq));
+    if (ioctl(fd, EVIOCGID, &identity.id) < 0) {
+        memset(&identity.id, 0, sizeof(identity.id));
+        return false;
+    }
+    return true;
+}
 
-    // Mark that an error did indeed occur; applyCalibration will detect if this handler has run
-    xErrorOccurred = true;
+/**
+ * @brief Looks up the touchscreens' event nodes through sysfs without opening any devices
+ * @return The paths to the device nodes, which may be empty
+ */
+static QStringList findTouchScreensInSysfs()
+{
+    // Each input device's name is available as a plain file, so we can find the
+    // right event nodes without opening (and possibly blocking on) every device
+    QStringList paths;
+    QDir classDir(SYSFS_INPUT_CLASS_DIR);
+    QStringList events = classDir.entryList(QStringList() << "event*", QDir::Dirs);
+    for (QString const &event : events) {
+        QFile nameFile(classDir.absoluteFilePath(event + "/device/name"));
+        if (nameFile.open(QFile::ReadOnly) &&
+            nameFile.readLine().trimmed() == CHUMBY_TOUCHSCREEN_NAME) {
+            paths << QStringLiteral("/dev/input/") + event;
+        }
+    }
 
-    return 0;
+    return paths;
 }
 
 /**
- * @brief Finds the touchscreen, and returns an opened file descriptor to it if found
- * @return The file descriptor if found, or -1 if it's not found
+ * @brief Searches every node in /dev/input for touchscreens by opening each one
+ * @param fds Filled in with the file descriptors of the touchscreens found
+ * @param paths Filled in with their paths
  */
-int CalibrationUtils::findTouchScreen()
+static void findTouchScreensByScanning(QVector<int> &fds, QStringList &paths)
 {
-    // Search /dev/input and try to find the touchscreen
+    // Search /dev/input and try to find the touchscreens
     QDir inputDir("/dev/input");
     QStringList inputs = inputDir.entryList(QDir::System);
     for (QString const &inputDevice : inputs)
     {
         QString fullPath = inputDir.absoluteFilePath(inputDevice);
-        int fd = ::open(fullPath.toUtf8().constData(), O_RDONLY | O_NONBLOCK);
-        if (fd > 0) {
-            char name[32];
-            if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) >= 0) {
-                // Ensure it's null-terminated to be safe
-                name[sizeof(name)-1] = 0;
-            } else {
-                name[0] = 0;
-            }
+        int fd = CalibrationUtils::openTouchScreen(fullPath);
+        if (fd >= 0) {
+            fds.append(fd);
+            paths << fullPath;
+        }
+    }
+}
 
-            // If we found it, return it
-            if (!::strncmp(name, CHUMBY_TOUCHSCREEN_NAME, sizeof(name))) {
-                return fd;
+/**
+ * @brief Finds every touchscreen, and opens each one
+ * @param fullScan True to skip the cached paths and sysfs lookup and open every
+ *        device in /dev/input instead (mainly for timing comparisons)
+ * @param fds Filled in with the (non-blocking) file descriptors, owned by the caller
+ * @param paths Filled in with the path of each device node, in the same order
+ * @return True if at least one touchscreen was found
+ *
+ * The paths found last time are tried first. sysfs is still checked for any
+ * that weren't there last time, since that only reads a few small files. Only if
+ * neither finds anything do we fall back to opening everything in /dev/input.
+ */
+bool CalibrationUtils::findTouchScreens(bool fullScan, QVector<int> &fds, QStringList &paths)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QStringList cachedPaths;
+    bool fromCache = false;
+    bool fromSysfs = false;
+    fds.clear();
+    paths.clear();
+
+    if (!fullScan) {
+        // Are they still where we found them last time?
+        QFile cacheFile(TOUCHSCREEN_PATH_CACHE_FILE);
+        if (cacheFile.open(QFile::ReadOnly)) {
+            for (QByteArray const &line : cacheFile.readAll().split('\n')) {
+                if (!line.trimmed().isEmpty()) {
+                    cachedPaths << QString::fromUtf8(line.trimmed());
+                }
+            }
+        }
+        for (QString const &cachedPath : cachedPaths) {
+            int const fd = openTouchScreen(cachedPath);
+            if (fd >= 0) {
+                fds.append(fd);
+                paths << cachedPath;
+                fromCache = true;
             }
+        }
 
-            // Otherwise, close it
-            ::close(fd);
+        // Ask sysfs about any others. These still have to be verified, in case
+        // a device was replaced between looking it up and opening it.
+        for (QString const &path : findTouchScreensInSysfs()) {
+            if (paths.contains(path)) {
+                continue;
+            }
+            int const fd = openTouchScreen(path);
+            if (fd >= 0) {
+                fds.append(fd);
+                paths << path;
+                fromSysfs = true;
+            }
         }
+    }
 
+    // The slow way
+    if (fds.isEmpty()) {
+        findTouchScreensByScanning(fds, paths);
     }
 
-    qCritical("Unable to locate Chumby touchscreen");
-    return -1;
+    if (fds.isEmpty()) {
+        qCritical("Unable to locate Chumby touchscreen");
+        return false;
+    }
+
+    char const *method = fromCache ? (fromSysfs ? "cached path and sysfs" : "cached path") :
+                                     (fromSysfs ? "sysfs" : "full scan");
+    qDebug("Found %d touchscreen(s) at %s via %s in %lld us", fds.length(),
+           paths.join(", ").toUtf8().constData(), method,
+           static_cast<long long>(timer.nsecsElapsed() / 1000));
+
+    // Remember where they were for next time. writeFileAtomically() leaves the
+    // file alone if it's already right.
+    writeFileAtomically(TOUCHSCREEN_PATH_CACHE_FILE, paths.join("\n").toUtf8() + "\n");
+
+    return true;
 }
 
 /**
  * @brief Applies the supplied calibration system-wide
  * @param matrix The new 3x3 calibration matrix for libinput (top row, middle row, bottom row sequentially)
  * @return True on success, false on failure
+ *
+ * This is a one-shot convenience wrapper; keep a CalibrationSession around
+ * instead when applying more than one matrix.
  */
 bool CalibrationUtils::applyCalibration(QVector<float> const &matrix)
 {
-    bool retval = false;
-    bool found = false;
-    XID deviceID;
-    XDevice *device;
-    Atom matrixAtom;
-    Atom floatAtom;
-    XErrorHandler prevErrorHandler;
+    CalibrationSession session;
+    return session.apply(matrix);
+}
 
-    // Ensure there are exactly 9 entries in the calibration matrix
-    if (matrix.length() != 9) {
-        return false;
+/**
+ * @brief Formats a calibration matrix the way the libinput option wants it
+ * @param matrix The 3x3 calibration matrix (9 floats)
+ * @return The matrix as text, with the numbers separated by spaces
+ */
+static QByteArray formatMatrix(QVector<float> const &matrix)
+{
+    QByteArray text;
+    for (int i = 0; i < matrix.length(); i++) {
+        if (i > 0) {
+            text += " ";
+        }
+        text += QByteArray::number(matrix[i], 'f', 6);
     }
+    return text;
+}
 
-    // Reset our error status
-    xErrorOccurred = false;
-
-    // We are going to talk to the X server to modify the touchscreen's
-    // calibration matrix property live.
-    Display *display = XOpenDisplay(nullptr);
-    if (!display) {
-        // Couldn't open the display; something failed.
+/**
+ * @brief Saves new calibration parameters to disk
+ * @param calibrations The calibration of each touchscreen
+ * @return True on success, false on failure
+ */
+bool CalibrationUtils::saveNewCalibration(QList<DeviceCalibration> const &calibrations)
+{
+    // Ensure there are exactly 9 entries in every calibration matrix
+    if (calibrations.isEmpty() || calibrations.length() > MAX_CALIBRATION_RECORDS) {
         return false;
     }
-
-    // Install a special error handler because of how Xlib works. This feels icky,
-    // but it's the only way that Xlib can tell us if setting the calibration
-    // was successful. Save the old handler (likely installed by Qt) so we can
-    // restore it when we're done.
-    prevErrorHandler = XSetErrorHandler(touchScreenCalibrationErrorHandler);
-
-    // We need to find the touchscreen's device in X. Get a list of all of them
-    int deviceCount;
-    XDeviceInfo *devices = XListInputDevices(display, &deviceCount);
-    if (!devices) {
-        // If we couldn't get a device list, something's wrong.
-        goto exit_close_display;
+    for (DeviceCalibration const &calibration : calibrations) {
+        if (calibration.matrix.length() != 9) {
+            return false;
+        }
     }
 
-    // Now loop through them and try to find one that matches
-    for (int i = 0; !found && i < deviceCount; i++) {
-        QString deviceName(devices[i].name);
-        if (deviceName == CHUMBY_TOUCHSCREEN_NAME) {
-            // We found it!
-            deviceID = devices[i].id;
-            found = true;
+    // To save it, we need to write a new file for configuring the touchscreen.
+    // With just one, it applies to any touchscreen, same as always. With more,
+    // each gets its own section for the node it's on right now. Node numbers
+    // can change between boots, so --apply-saved uses the binary record, which
+    // goes by identity, to put each matrix back on the right device.
+    QByteArray outData;
+    for (int i = 0; i < calibrations.length(); i++) {
+        DeviceCalibration const &calibration = calibrations[i];
+        if (calibrations.length() == 1) {
+            outData += "Section \"InputClass\"\n"
+                       "\tIdentifier \"touchscreen\"\n";
+        } else {
+            outData += "# " + calibration.identity.key() + "\n";
+            outData += "Section \"InputClass\"\n"
+                       "\tIdentifier \"touchscreen " + QByteArray::number(i + 1) + "\"\n";
+        }
+        outData += "\tMatchIsTouchscreen \"TRUE\"\n"
+                   "\tMatchDriver \"libinput\"\n";
+        if (calibrations.length() > 1) {
+            outData += "\tMatchDevicePath \"" + calibration.path.toUtf8() + "\"\n";
         }
+        outData += "\tOption \"CalibrationMatrix\" \"" + formatMatrix(calibration.matrix) + "\"\n"
+                   "EndSection\n";
+    }
+
+    // If the binary record is about to change, get rid of the old one first. If we
+    // lose power partway through, the boot-time apply falls back to the config file
+    // instead of using a stale record.
+    QByteArray record;
+    for (DeviceCalibration const &calibration : calibrations) {
+        record += CalibrationRecordFile::build(calibration.matrix, calibration.axes, calibration.identity);
     }
-    XFreeDeviceList(devices);
-    if (!found) {
-        goto exit_close_display;
+    QFile recordFile(CALIBRATION_RECORD_FILE);
+    bool const recordIsCurrent = recordFile.open(QFile::ReadOnly) && recordFile.readAll() == record;
+    recordFile.close();
+    if (!recordIsCurrent) {
+        ::unlink(CALIBRATION_RECORD_FILE);
     }
 
-    // Now, we need to open the device
-    device = XOpenDevice(display, deviceID);
-    if (!device) {
-        goto exit_close_display;
+    // Save the new file
+    if (!writeFileAtomically(CALIBRATION_FILE, outData)) {
+        qCritical("Unable to save calibration file");
+        return false;
     }
 
-    // Find the property
-    matrixAtom = XInternAtom(display, LIBINPUT_CALIBRATION_PROPERTY, true);
-    if (matrixAtom == None)
-    {
-        goto exit_close_device;
+    // The record is only a shortcut, so failing to write it isn't fatal
+    if (!recordIsCurrent && !writeFileAtomically(CALIBRATION_RECORD_FILE, record)) {
+        qCritical("Unable to save calibration record");
     }
 
-    // We also need to be able to set "float" properties which doesn't seem
-    // to be built into X11, so grab the atom representing it
-    floatAtom = XInternAtom(display, "FLOAT", true);
-    if (floatAtom == None)
-    {
-        goto exit_close_device;
+    return true;
+}
+
+/**
+ * @brief Writes all of a buffer to a file descriptor
+ * @param fd The file descriptor
+ * @param data The data to write
+ * @param length The number of bytes to write
+ * @return True on success, false on failure
+ */
+static bool writeAll(int fd, char const *data, size_t length)
+{
+    while (length > 0) {
+        ssize_t result = ::write(fd, data, length);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += result;
+        length -= static_cast<size_t>(result);
     }
+    return true;
+}
 
-    // Now we can finally attempt to set the new property value of 9 floats
-    XChangeDeviceProperty(display, device, matrixAtom, floatAtom, 32, PropModeReplace,
-                          reinterpret_cast<const unsigned char *>(matrix.constData()), matrix.length());
-    // So Xlib is kind of confusing for setting properties. There is no error
-    // handling here. If setting this property fails, this function doesn't tell
-    // me. Instead, an error handler will run sometime in the future. So we had
-    // to register a custom error handler above to let us know if it failed. Crazy...
+/**
+ * @brief Replaces a file's contents so that it's never left half-written, and only if they changed
+ * @param path The file to replace
+ * @param contents The new contents
+ * @return True if the file now has the new contents, false on failure (the old file is untouched)
+ *
+ * The settings partition is flash, so rewriting a file with what's already in it
+ * is skipped entirely. Otherwise the new contents go to a temporary file next to
+ * it, which is synced and then renamed over the original. The rename is atomic,
+ * so losing power at any point leaves either the old file or the new one. The
+ * directory is synced afterward so the rename itself is on flash too.
+ */
+bool CalibrationUtils::writeFileAtomically(QString const &path, QByteArray const &contents)
+{
+    QFile existing(path);
+    if (existing.open(QFile::ReadOnly) && existing.readAll() == contents) {
+        qDebug("%s is unchanged, not rewriting it", path.toUtf8().constData());
+        return true;
+    }
+    existing.close();
 
-    // So assume we succeeded here, and we'll check for Xlib errors when we return.
-    retval = true;
+    QByteArray const finalPath = path.toUtf8();
+    QByteArray const tempPath = finalPath + ".tmp";
+    int fd = ::open(tempPath.constData(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        qCritical("Unable to create %s", tempPath.constData());
+        return false;
+    }
 
-exit_close_device:
-    XCloseDevice(display, device);
+    bool const ok = writeAll(fd, contents.constData(), static_cast<size_t>(contents.length())) &&
+                    ::fsync(fd) == 0;
+    if (::close(fd) < 0 || !ok) {
+        qCritical("Unable to write %s", tempPath.constData());
+        ::unlink(tempPath.constData());
+        return false;
+    }
 
-exit_close_display:
-    // All done with the display
-    XCloseDisplay(display);
+    if (::rename(tempPath.constData(), finalPath.constData()) < 0) {
+        qCritical("Unable to replace %s", finalPath.constData());
+        ::unlink(tempPath.constData());
+        return false;
+    }
 
-    // Restore the original error handler; if an error happened, we've already been notified
-    // by the time we reach this point.
-    XSetErrorHandler(prevErrorHandler);
+    // Make sure the directory entry for the rename makes it to flash as well. If
+    // this fails, the file is still intact; it just might be the old one after a crash.
+    int const slash = finalPath.lastIndexOf('/');
+    QByteArray const dirPath = slash > 0 ? finalPath.left(slash) : QByteArray(slash == 0 ? "/" : ".");
+    int dirFd = ::open(dirPath.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0) {
+        ::fsync(dirFd);
+        ::close(dirFd);
+    }
 
-    // As long as we think we succeeded, and no X errors occurred while we were doing
-    // our thing, we succeeded.
-    return retval && !xErrorOccurred;
+    return true;
 }
 
 /**
- * @brief Saves new calibration parameters to disk
- * @param matrix The new 3x3 calibration matrix for libinput (top row, middle row, bottom row sequentially)
- * @return True on success, false on failure
+ * @brief Finds the value of an option in one section of the saved config file
+ * @param section The text of the section
+ * @param option The option name, including its quotes
+ * @param value Filled in with the value, without its quotes
+ * @return True if the option was found, false if not
  */
-bool CalibrationUtils::saveNewCalibration(QVector<float> const &matrix)
+static bool findOptionValue(QByteArray const &section, QByteArray const &option, QByteArray &value)
 {
-    // Ensure there are exactly 9 entries in the calibration matrix
-    if (matrix.length() != 9) {
+    QByteArray const optionStart = option + " \"";
+    int start = section.indexOf(optionStart);
+    int end = start < 0 ? -1 : section.indexOf('"', start + optionStart.length());
+    if (end < 0) {
         return false;
     }
+    start += optionStart.length();
+    value = section.mid(start, end - start);
+    return true;
+}
 
-    // To save it, we need to write a new file for configuring the touchscreen.
-    QByteArray const calibrationFilePrefix =
-        "Section \"InputClass\"\n"
-        "\tIdentifier \"touchscreen\"\n"
-        "\tMatchIsTouchscreen \"TRUE\"\n"
-        "\tMatchDriver \"libinput\"\n"
-        "\tOption \"CalibrationMatrix\" \"";
-
-    QByteArray const calibrationFileSuffix =
-        "\"\n"
-        "EndSection\n";
-
-    // Assemble the new file contents using the provided matrix
-    QByteArray outData = calibrationFilePrefix;
-    for (int i = 0; i < matrix.length(); i++) {
-        if (i > 0) {
-            outData += " ";
-        }
-        outData += QByteArray::number(matrix[i], 'f', 6);
-    }
-    outData += calibrationFileSuffix;
-
-    // Save the new file
+/**
+ * @brief Loads the calibration matrices that were previously saved to disk
+ * @param calibrations Filled in with each saved matrix, and the device path it's
+ *        for if there's more than one touchscreen (the identity and axes aren't in the file)
+ * @return True on success, false on failure
+ */
+bool CalibrationUtils::loadSavedCalibration(QList<DeviceCalibration> &calibrations)
+{
     QFile calFile(CALIBRATION_FILE);
-    if (!calFile.open(QFile::WriteOnly | QFile::Truncate)) {
-        qCritical("Unable to open calibration file for saving");
+    if (!calFile.open(QFile::ReadOnly)) {
+        qCritical("Unable to open saved calibration file");
         return false;
     }
-    qint64 written = calFile.write(outData);
+    QByteArray const contents = calFile.readAll();
     calFile.close();
 
-    if (written != outData.length()) {
-        qCritical("Unable to write calibration file");
-        return false;
+    // Go through each section that saveNewCalibration wrote
+    calibrations.clear();
+    QByteArray const sectionEnd = "EndSection";
+    int start = 0;
+    int end;
+    while ((end = contents.indexOf(sectionEnd, start)) >= 0) {
+        QByteArray const section = contents.mid(start, end - start);
+        start = end + sectionEnd.length();
+
+        QByteArray matrixText;
+        if (!findOptionValue(section, "\"CalibrationMatrix\"", matrixText)) {
+            continue;
+        }
+
+        QList<QByteArray> const values = matrixText.simplified().split(' ');
+        if (values.length() != 9) {
+            qCritical("Saved calibration matrix doesn't have 9 entries");
+            return false;
+        }
+
+        DeviceCalibration calibration;
+        QByteArray path;
+        if (findOptionValue(section, "MatchDevicePath", path)) {
+            calibration.path = QString::fromUtf8(path);
+        }
+        calibration.matrix.reserve(9);
+        for (QByteArray const &value : values) {
+            bool ok;
+            calibration.matrix.append(value.toFloat(&ok));
+            if (!ok) {
+                qCritical("Invalid number in saved calibration matrix");
+                return false;
+            }
+        }
+        calibrations.append(calibration);
     }
 
+    if (calibrations.isEmpty()) {
+        qCritical("No calibration matrix found in saved calibration file");
+        return false;
+    }
     return true;
 }
+
+/**
+ * @brief Loads the binary calibration records saved alongside the config file
+ * @param records Filled in with the records, one per touchscreen
+ * @return True if there's a valid record file, false otherwise
+ */
+bool CalibrationUtils::loadCalibrationRecords(QVector<CalibrationRecord> &records)
+{
+    return CalibrationRecordFile::load(CALIBRATION_RECORD_FILE, records);
+}
+
+/**
+ * @brief Picks out the saved matrix for one touchscreen
+ * @param records The saved calibration records, which know which touchscreen each is for
+ * @param calibrations The calibrations from the config file, which only know the device node
+ * @param identity The touchscreen's identity
+ * @param path The device node it's at now
+ * @param matrix Filled in with its calibration matrix
+ * @return True if it has a saved calibration
+ */
+bool CalibrationUtils::findSavedMatrix(QVector<CalibrationRecord> const &records,
+                                       QList<DeviceCalibration> const &calibrations,
+                                       TouchIdentity const &identity, QString const &path, float matrix[9])
+{
+    int const record = CalibrationRecordFile::find(records, identity);
+    if (record >= 0) {
+        memcpy(matrix, records[record].matrix, 9 * sizeof(float));
+        return true;
+    }
+    for (DeviceCalibration const &calibration : calibrations) {
+        if (calibration.path.isEmpty() || calibration.path == path) {
+            memcpy(matrix, calibration.matrix.constData(), 9 * sizeof(float));
+            return true;
+        }
+    }
+    return false;
+}
@@ -19,10 +19,32 @@
 #ifndef CALIBRATIONUTILS_H
 #define CALIBRATIONUTILS_H
 
+#include <QList>
+#include <QString>
+#include <QStringList>
 #include <QVector>
+#include <linux/input.h>
+#include "calibrationrecord.h"
+#include "touchaxes.h"
+#include "touchidentity.h"
 
-/// The range of raw samples from the uncalibrated touchscreen
-#define RAW_TOUCHSCREEN_RANGE             4095
+/// The name to look for in order to identify the touchscreen
+#define CHUMBY_TOUCHSCREEN_NAME         "Chumby 8 touchscreen"
+
+/**
+ * @brief The result of calibrating one touchscreen
+ */
+struct DeviceCalibration
+{
+    /// Who the touchscreen is
+    TouchIdentity identity;
+    /// The device node it was found at this time
+    QString path;
+    /// The raw ranges it was calibrated with
+    TouchAxes axes;
+    /// The new 3x3 calibration matrix for libinput (top row, middle row, bottom row sequentially)
+    QVector<float> matrix;
+};
 
 /**
  * @brief Utility functions for calibrating the Chumby 8's touchscreen
@@ -30,9 +52,18 @@
 class CalibrationUtils
 {
 public:
-    static int findTouchScreen();
+    static bool findTouchScreens(bool fullScan, QVector<int> &fds, QStringList &paths);
+    static int openTouchScreen(QString const &path);
+    static bool readTouchAxes(int fd, TouchAxes &axes);
+    static bool readDeviceIdentity(int fd, TouchIdentity &identity);
     static bool applyCalibration(QVector<float> const &matrix);
-    static bool saveNewCalibration(QVector<float> const &matrix);
+    static bool saveNewCalibration(QList<DeviceCalibration> const &calibrations);
+    static bool writeFileAtomically(QString const &path, QByteArray const &contents);
+    static bool loadSavedCalibration(QList<DeviceCalibration> &calibrations);
+    static bool loadCalibrationRecords(QVector<CalibrationRecord> &records);
+    static bool findSavedMatrix(QVector<CalibrationRecord> const &records,
+                                QList<DeviceCalibration> const &calibrations,
+                                TouchIdentity const &identity, QString const &path, float matrix[9]);
 };
 
 #endif // CALIBRATIONUTILS_H
@@ -17,64 +17,184 @@
  */
 
 #include "calibrationwindow.h"
+#include "calibrationsession.h"
 #include "calibrationutils.h"
-#include <QApplication>
+#include "processstats.h"
+#include "startupprofile.h"
+#include <QGuiApplication>
+#include <QPaintEvent>
 #include <QPainter>
 #include <QScreen>
+#include <cmath>
+#include <cstdlib>
+#include <errno.h>
 #include <linux/input.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <QTimer>
 
-/// Offset (in pixels) from edges of screen to centers of calibration crosshairs
-#define CROSSHAIR_OFFSET                20
 /// Width/height of calibration crosshairs in pixels
 #define CROSSHAIR_SIZE                  20
-/// Number of points needed for calibration
-#define NUM_CAL_POINTS                  4
-/// Maximum number of samples to average for each calibration point
-#define MAX_AVG_POINTS                  5
+/// Width of the touch trails drawn while verifying a calibration
+#define TRAIL_WIDTH                     2
+/// How close (in pixels) the end of a trail has to be to a target to measure its error
+#define VERIFY_TARGET_RADIUS            40
+/// Extra space (in pixels) above and below the instructions that counts as tapping them
+#define VERIFY_SAVE_MARGIN              20
+/// Size of the error readout drawn next to each target while verifying
+#define VERIFY_LABEL_WIDTH              90
+#define VERIFY_LABEL_HEIGHT             20
+/// Signal that prints the input and latency statistics without quitting
+#define DUMP_STATISTICS_SIGNAL          SIGUSR1
+/// Longest command a fixture can send in scripted mode
+#define SCRIPT_MAX_LINE                 256
+
+/// Socket pair used to get from the signal handlers back into the event loop
+static int signalFds[2] = {-1, -1};
+
+/// Why a calibration failed, as reported to a fixture (matching the telemetry outcomes)
+static char const * const failureNames[] = {
+    "ok",
+    "solve-failed",
+    "residual-too-large",
+    "out-of-range"
+};
+
+/**
+ * @brief Sends a line to the fixture in scripted mode
+ * @param format printf-style format of the line, including its newline
+ *
+ * stdout is flushed right away, since it's usually a pipe or socket that
+ * would otherwise hold on to everything until the program exits.
+ */
+static void scriptReport(char const *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    fflush(stdout);
+}
 
 /**
  * @brief Constructor for CalibrationWindow
+ * @param options Settings for this calibration run
  * @param parent The parent widget, which should be nullptr because this is a full-screen window.
  */
-CalibrationWindow::CalibrationWindow(QWidget *parent) :
-    QMainWindow(parent),
+CalibrationWindow::CalibrationWindow(CalibrationOptions const &options, CalibrationWindowParent *parent) :
+    CalibrationWindowBase(parent),
     _instructionsLabel(this),
-    _curCalPoint(0),
-    _calibrationNotifier(nullptr),
-    _tmpPressed(0),
-    _touchIsPressed(false),
-    _minXCal(0),
-    _maxXCal(0),
-    _minYCal(0),
-    _maxYCal(0)
-{
-    // Fill out the four points
-    QSize screenSize = qApp->screens().at(0)->size();
-    _crosshairPoints << QPoint(CROSSHAIR_OFFSET, CROSSHAIR_OFFSET);
-    _crosshairPoints << QPoint(screenSize.width() - CROSSHAIR_OFFSET, CROSSHAIR_OFFSET);
-    _crosshairPoints << QPoint(screenSize.width() - CROSSHAIR_OFFSET, screenSize.height() - CROSSHAIR_OFFSET);
-    _crosshairPoints << QPoint(CROSSHAIR_OFFSET, screenSize.height() - CROSSHAIR_OFFSET);
-
-    // Add explanation text
-    _instructionsLabel.setText("To calibrate the touchscreen, tap each crosshair point that appears.");
+    _numPoints(options.calibrationPoints),
+    _pressureGate(options.pressureGate),
+    _calibrator(options.calibrationPoints, QGuiApplication::primaryScreen()->size()),
+    _deviceWatcher(nullptr),
+    _epollFd(::epoll_create1(EPOLL_CLOEXEC)),
+    _epollNotifier(nullptr),
+    _useInputThread(options.inputThread),
+    _exclusive(options.exclusive),
+    _recordFile(options.recordFile),
+    _recording(nullptr),
+    _paintPending(false),
+    _painted(false),
+    _instructionsPending(false),
+    _layoutPending(false),
+    _finishPending(false),
+    _signalNotifier(nullptr),
+    _calibrating(nullptr),
+    _haveCalibratingIdentity(false),
+    _maxResidual(0),
+    _done(false),
+    _haveUnsavedCalibration(false),
+    _verify(options.verify),
+    _verifying(false),
+    _trailDevice(nullptr),
+    _checkingProfile(false),
+    _tapTolerance(options.tapTolerance),
+    _checkDevice(nullptr),
+    _checkFrames(0),
+    _checkCount(0),
+    _checkFinished(false),
+    _exitCode(EXIT_SUCCESS),
+    _scripted(options.scripted),
+    _scriptFinished(false),
+    _scriptNotifier(nullptr),
+    _telemetryFile(options.telemetryFile),
+    _telemetryLimit(options.telemetryLimit),
+    _startupSeconds(-1),
+    _waitStartSeconds(-1),
+    _firstTouchSeconds(-1),
+    _calibratedSeconds(-1)
+{
+    StartupProfile::mark(StartupProfile::WindowCreated);
+#ifndef CHUMBY8TSCAL_LITE
+    // Everything we paint is opaque, so there's no point in Qt clearing the
+    // background first. On the Chumby's unaccelerated X server that's a full
+    // screen software fill every time.
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    // Add explanation text. The lite build's glyphs are rasterized at the same size.
     _instructionsLabel.setStyleSheet("font-size: 20px;");
     _instructionsLabel.setAlignment(Qt::AlignCenter);
+#endif
+    setupSignals();
 
-    // Find the touchscreen and listen for it
-    _calibrationFd = CalibrationUtils::findTouchScreen();
-    if (_calibrationFd < 0) {
-        _instructionsLabel.setText("Unable to find touchscreen.");
-        _curCalPoint = NUM_CAL_POINTS;
-        // Since the touchscreen isn't working, bail after 5 seconds
-        QTimer::singleShot(5000, qApp, &QApplication::quit);
-    } else {
-        // As long as we successfully opened up the touchscreen, listen for raw events
-        _calibrationNotifier = new QSocketNotifier(_calibrationFd, QSocketNotifier::Read, this);
-        connect(_calibrationNotifier, &QSocketNotifier::activated, this, &CalibrationWindow::readRawEvents);
-        _calibrationNotifier->setEnabled(true);
+    // In scripted mode, the fixture can send commands on stdin
+    if (_scripted) {
+        _scriptNotifier = new QSocketNotifier(STDIN_FILENO, QSocketNotifier::Read, this);
+        connect(_scriptNotifier, &QSocketNotifier::activated, this, &CalibrationWindow::readScriptCommands);
+    }
+
+    // Every touchscreen is watched through the one epoll descriptor, so the
+    // event loop only has a single notifier to deal with however many there are
+    if (_epollFd < 0) {
+        qCritical("Unable to create epoll instance");
+        setInstructions("Unable to read touchscreens.");
+        if (_scripted) {
+            finishScript(false, "no-touchscreen");
+        }
+        QTimer::singleShot(5000, qApp, &QCoreApplication::quit);
+        flushUi();
+        return;
     }
+    _epollNotifier = new QSocketNotifier(_epollFd, QSocketNotifier::Read, this);
+    connect(_epollNotifier, &QSocketNotifier::activated, this, &CalibrationWindow::readDevices);
+
+    // Start watching for devices before looking for the touchscreens, so one
+    // can't slip in between the search and the watch
+    _deviceWatcher = new DeviceWatcher(this);
+    connect(_deviceWatcher, &DeviceWatcher::deviceAdded, this, &CalibrationWindow::touchScreenAdded);
+    connect(_deviceWatcher, &DeviceWatcher::deviceRemoved, this, &CalibrationWindow::touchScreenRemoved);
+
+    // An imported profile only needs checking, not calibrating
+    if (!options.profile.isEmpty()) {
+        startTapCheck(options.profile);
+    }
+
+    // Find the touchscreens and listen for them
+    QVector<int> fds;
+    QStringList paths;
+    CalibrationUtils::findTouchScreens(options.fullScan, fds, paths);
+    for (int i = 0; i < fds.length(); i++) {
+        attachTouchScreen(fds[i], paths[i]);
+    }
+    StartupProfile::mark(StartupProfile::TouchScreensFound);
+    chooseNextDevice();
+
+    if (_devices.isEmpty() && !_deviceWatcher->isValid()) {
+        setInstructions("Unable to find touchscreen.");
+        if (_scripted) {
+            finishScript(false, "no-touchscreen");
+        }
+        // Since the touchscreen isn't working and we can't wait for it, bail after 5 seconds
+        QTimer::singleShot(5000, qApp, &QCoreApplication::quit);
+    }
+    flushUi();
+    StartupProfile::mark(StartupProfile::WindowConstructed);
 }
 
 /**
@@ -82,26 +202,346 @@ CalibrationWindow::CalibrationWindow(QWidget *parent) :
  */
 CalibrationWindow::~CalibrationWindow()
 {
-    // Nothing to do; Qt's parenting system takes care of everything.
+    // A touchscreen that was left partway through still gets a record
+    if (!_done) {
+        recordTelemetry();
+    }
+
+    // Qt's parenting system takes care of everything else, but the input
+    // threads have to be stopped before their statistics can be read. Deleting
+    // the devices also gives them back to X as soon as we're done with them.
+    for (TouchScreenDevice *device : _devices) {
+        device->stopInputThread();
+        device->logStatistics();
+        addDeviceTelemetry(device);
+        delete device;
+    }
+    _devices.clear();
+    _latency.logStatistics();
+    if (!_telemetry.isEmpty()) {
+        for (TelemetryRecord &record : _telemetry) {
+            Telemetry::addLatency(record, _latency);
+        }
+        Telemetry::append(_telemetryFile, _telemetryLimit, _telemetry);
+    }
+    qDebug("Peak resident memory: %ld KiB", ProcessStats::peakResidentKilobytes());
+    if (_calibrator.gatedSamples() > 0) {
+        qDebug("%lu touch samples ignored by the pressure gate", _calibrator.gatedSamples());
+    }
+    _recorder.close();
+
+    if (_epollFd >= 0) {
+        delete _epollNotifier;
+        ::close(_epollFd);
+    }
+
+    if (_signalNotifier) {
+        signal(DUMP_STATISTICS_SIGNAL, SIG_DFL);
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        ::close(signalFds[0]);
+        ::close(signalFds[1]);
+        signalFds[0] = signalFds[1] = -1;
+    }
+}
+
+/**
+ * @brief Starts listening to a touchscreen
+ * @param fd The touchscreen's (non-blocking) file descriptor, which this window now owns
+ * @param path The device node it was opened from
+ *
+ * This is used both at startup and whenever a touchscreen appears later,
+ * including one coming back after disappearing.
+ */
+void CalibrationWindow::attachTouchScreen(int fd, QString const &path)
+{
+    if (_devices.length() >= MAX_CALIBRATION_RECORDS) {
+        qCritical("Too many touchscreens, ignoring %s", path.toUtf8().constData());
+        ::close(fd);
+        return;
+    }
+
+    TouchScreenDevice *device = new TouchScreenDevice(fd, path);
+    qDebug("Touchscreen %s is %s", path.toUtf8().constData(), device->identity().key().constData());
+    _latency.setClock(device->clock());
+
+    // Keep X's input driver from seeing the touches while we're using them.
+    // Otherwise it moves the pointer, clicks on things underneath us and triggers
+    // redraws, all competing with us for the CPU.
+    if (_exclusive) {
+        device->grab();
+    }
+
+    // Save everything we read from the first touchscreen if asked, so it can be
+    // replayed later. A capture only has room for one device's ranges. If that
+    // one comes back, it just carries on in the same file.
+    bool startedRecording = false;
+    if (!_recordFile.isEmpty()) {
+        if (!_recorder.isOpen()) {
+            startedRecording = true;
+            _recorder.open(_recordFile, _numPoints, _calibrator.screenSize(), device->axes());
+            _recordingIdentity = device->identity();
+            _recording = device;
+        } else if (!_recording && device->identity() == _recordingIdentity) {
+            _recording = device;
+        }
+    }
+
+    if (_useInputThread) {
+        device->startInputThread(_recording == device ? &_recorder : nullptr);
+    }
+
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = device;
+    if (epoll_ctl(_epollFd, EPOLL_CTL_ADD, device->readyFd(), &event) < 0) {
+        qCritical("Unable to watch touchscreen %s", path.toUtf8().constData());
+        if (_recording == device) {
+            _recording = nullptr;
+        }
+        delete device;
+
+        // Nothing was read from it, so let the next touchscreen start the capture
+        if (startedRecording) {
+            _recorder.close();
+        }
+        return;
+    }
+    _devices.append(device);
+}
+
+/**
+ * @brief Stops listening to a touchscreen after it has gone away
+ * @param device The touchscreen, which is deleted
+ */
+void CalibrationWindow::detachTouchScreen(TouchScreenDevice *device)
+{
+    qDebug("Touchscreen at %s disappeared", device->path().toUtf8().constData());
+
+    epoll_ctl(_epollFd, EPOLL_CTL_DEL, device->readyFd(), nullptr);
+    _devices.removeOne(device);
+    device->stopInputThread();
+    device->logStatistics();
+    addDeviceTelemetry(device);
+    if (_recording == device) {
+        _recording = nullptr;
+    }
+    if (_trailDevice == device) {
+        _trailDevice = nullptr;
+    }
+    if (_checkDevice == device) {
+        _checkDevice = nullptr;
+    }
+
+    // If it was the one being calibrated, whatever touch was in progress is gone
+    // too. Its progress is kept in case it comes back.
+    if (_calibrating == device) {
+        _calibrating = nullptr;
+        _calibrator.abandonTouch();
+        chooseNextDevice();
+    }
+
+    delete device;
+}
+
+/**
+ * @brief Lets the rest of the system see the touchscreens again, if they were grabbed
+ */
+void CalibrationWindow::releaseTouchScreens()
+{
+    for (TouchScreenDevice *device : _devices) {
+        device->release();
+    }
+}
+
+/**
+ * @brief Called when a new input device node appears
+ * @param path The path to the device node
+ */
+void CalibrationWindow::touchScreenAdded(QString const &path)
+{
+    for (TouchScreenDevice const *device : _devices) {
+        if (device->path() == path) {
+            return;
+        }
+    }
+
+    // Only this one node needs checking, not everything in /dev/input
+    int const fd = CalibrationUtils::openTouchScreen(path);
+    if (fd < 0) {
+        return;
+    }
+
+    qDebug("Touchscreen appeared at %s", path.toUtf8().constData());
+    attachTouchScreen(fd, path);
+    if (!_calibrating) {
+        chooseNextDevice();
+    }
+    flushUi();
+}
+
+/**
+ * @brief Called when an input device node is removed
+ * @param path The path to the device node
+ */
+void CalibrationWindow::touchScreenRemoved(QString const &path)
+{
+    for (TouchScreenDevice *device : _devices) {
+        if (device->path() == path) {
+            detachTouchScreen(device);
+            flushUi();
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Determines whether a touchscreen has already been calibrated in this run
+ * @param identity The touchscreen's identity
+ * @return True if it has
+ */
+bool CalibrationWindow::isCalibrated(TouchIdentity const &identity) const
+{
+    return resultIndex(identity) >= 0;
+}
+
+/**
+ * @brief Finds a touchscreen's calibration from this run
+ * @param identity The touchscreen's identity
+ * @return The index of its calibration in _results, or -1 if it doesn't have one yet
+ */
+int CalibrationWindow::resultIndex(TouchIdentity const &identity) const
+{
+    for (int i = 0; i < _results.length(); i++) {
+        if (_results[i].identity == identity) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Picks the touchscreen to calibrate next, if there's one that still needs it
+ *
+ * If the one we were partway through is back, it carries on from the same
+ * crosshair. Otherwise the next touchscreen that hasn't been done yet starts
+ * from the beginning.
+ */
+void CalibrationWindow::chooseNextDevice()
+{
+    if (_done) {
+        return;
+    }
+
+    TouchScreenDevice *next = nullptr;
+    for (TouchScreenDevice *device : _devices) {
+        if (_haveCalibratingIdentity && device->identity() == _calibratingIdentity) {
+            next = device;
+            break;
+        }
+        if (!next && !isCalibrated(device->identity())) {
+            next = device;
+        }
+    }
+
+    if (!next) {
+        // Hide the crosshair so nobody taps it for nothing
+        _calibrating = nullptr;
+        queueRepaint(_crosshairRect);
+        _crosshairRect = QRect();
+        setInstructions(_haveCalibratingIdentity ?
+                        "Touchscreen disconnected. Waiting for it to come back..." :
+                        "Waiting for the touchscreen...");
+        if (_scripted) {
+            scriptReport("waiting\n");
+        }
+        return;
+    }
+
+    bool const resuming = _haveCalibratingIdentity && next->identity() == _calibratingIdentity;
+    _calibrating = next;
+    if (!resuming) {
+        _calibrator = Calibrator(_numPoints, _calibrator.screenSize());
+        _calibrator.setPressureGate(_pressureGate);
+        _calibratingIdentity = next->identity();
+        _haveCalibratingIdentity = true;
+        if (!_telemetryFile.isEmpty()) {
+            _waitStartSeconds = ProcessStats::secondsSinceStart();
+            _firstTouchSeconds = -1;
+        }
+    }
+    _calibrator.setAxes(next->axes());
+    _calibrator.abandonTouch();
+
+    // Say which one it is if there's more than one to do
+    int remaining = 0;
+    for (TouchScreenDevice const *device : _devices) {
+        if (!isCalibrated(device->identity())) {
+            remaining++;
+        }
+    }
+    int const total = _results.length() + remaining;
+    if (total > 1) {
+        setInstructions(QString("Tap each crosshair point that appears using touchscreen %1 of %2.")
+                        .arg(_results.length() + 1).arg(total));
+    } else {
+        setInstructions("To calibrate the touchscreen, tap each crosshair point that appears.");
+    }
+
+    // Now that there's a touchscreen, show the current crosshair
+    queueRepaint(_crosshairRect);
+    _crosshairRect = crosshairRect(_calibrator.targets().at(_calibrator.currentPoint()));
+    queueRepaint(_crosshairRect);
+    announceTarget();
 }
 
 /**
  * @brief Handler called when this window needs to redraw itself
+ * @param event Describes the region that needs to be redrawn
  */
-void CalibrationWindow::paintEvent(QPaintEvent *)
+void CalibrationWindow::paintEvent(QPaintEvent *event)
 {
+#ifdef CHUMBY8TSCAL_LITE
+    QPainter p(paintDevice());
+#else
     QPainter p(this);
-    p.fillRect(rect(), Qt::white);
-    p.setPen(QPen(Qt::black, 1.0f));
+#endif
+    StartupProfile::mark(StartupProfile::FirstPaintStarted);
+
+    if (_verifying) {
+        // Everything is already drawn in the image; just copy out the damage
+        for (QRect const &r : event->region()) {
+            p.drawImage(r, _verifyImage, r);
+        }
+    } else {
+        // Only fill what was damaged. The region is usually an old and a new crosshair
+        // in opposite corners, so filling its bounding rect would be most of the screen.
+        for (QRect const &r : event->region()) {
+            p.fillRect(r, Qt::white);
+        }
+        p.setPen(QPen(Qt::black, 1.0f));
+
+        // Draw the crosshair at the current calibration point (if any)
+        if (_crosshairRect.intersects(event->rect()))
+        {
+            drawCrosshair(p, _crosshairRect.center());
+        }
+    }
 
-    // Draw the crosshair at the current calibration point (if any)
-    if (_curCalPoint < _crosshairPoints.length())
-    {
-        QPoint const &point = _crosshairPoints[_curCalPoint];
-        p.drawLine(point.x() - CROSSHAIR_SIZE/2, point.y(),
-                   point.x() + CROSSHAIR_SIZE/2, point.y());
-        p.drawLine(point.x(), point.y() - CROSSHAIR_SIZE/2,
-                   point.x(), point.y() + CROSSHAIR_SIZE/2);
+    // Startup is over once there's something on the screen
+    if (!_painted) {
+        _painted = true;
+        _startupSeconds = ProcessStats::secondsSinceStart();
+        qDebug("Startup took %.0f ms from process start to the first frame", _startupSeconds * 1000);
+        StartupProfile::mark(StartupProfile::FirstPaintFinished);
+        StartupProfile::logBreakdown();
+    }
+
+    // If a touch caused this repaint, we've now done everything we can to show it
+    if (_paintPending) {
+        _latency.record(LatencyStats::HandleToPaint, _paintRequestTime, _latency.now());
+        _paintPending = false;
     }
 }
 
@@ -110,178 +550,906 @@ void CalibrationWindow::paintEvent(QPaintEvent *)
  */
 void CalibrationWindow::resizeEvent(QResizeEvent *)
 {
-    // Make sure the instructions label is correctly sized
-    _instructionsLabel.setGeometry(rect());
+    layoutInstructions();
 }
 
 /**
- * @brief Reads raw events from the touchscreen when available and parses them
+ * @brief Positions the instructions label
  */
-void CalibrationWindow::readRawEvents()
+void CalibrationWindow::layoutInstructions()
 {
-    // Read events as long as we can
-    ssize_t result;
-    do {
-        input_event event;
-        result = ::read(_calibrationFd, &event, sizeof(input_event));
-        if (result == sizeof(input_event)) {
-            switch (event.type) {
-            case EV_KEY:
-                // Look for touch state change, save in temporary variable
-                if (event.code == BTN_TOUCH) {
-                    _tmpPressed = event.value != 0;
-                }
-                break;
-            case EV_ABS:
-                // Look for X and Y changes, save in temporary variable
-                if (event.code == ABS_X) {
-                    _tmpXY.setX(event.value);
-                } else if (event.code == ABS_Y) {
-                    _tmpXY.setY(event.value);
-                }
-                break;
-            case EV_SYN:
-                // When a syn report occurs, we have a full sample to process from the touchscreen
-                if (event.code == SYN_REPORT) {
-                    handleTouchUpdate(_tmpXY, _tmpPressed);
-                }
-                break;
+    // Keep the instructions label to a band across the screen, just tall enough
+    // for the text. It's transparent, so whenever its text changes the window has
+    // to repaint whatever is underneath it, and this keeps that small. While
+    // verifying, it moves down out of the way of the middle row of targets,
+    // since tapping it means saving.
+    int const labelHeight = _instructionsLabel.sizeHint().height();
+    int const center = _verifying ? height() * 3 / 4 : height() / 2;
+    _instructionsLabel.setGeometry(0, center - labelHeight / 2, width(), labelHeight);
+}
+
+/**
+ * @brief Reads whichever touchscreens (or their input threads) have something for us
+ *
+ * Every frame that arrived since the last time around the event loop is
+ * handled first, from all of the touchscreens, and then the screen is updated
+ * once for all of them.
+ */
+void CalibrationWindow::readDevices()
+{
+    epoll_event ready[MAX_CALIBRATION_RECORDS];
+    int const count = epoll_wait(_epollFd, ready, MAX_CALIBRATION_RECORDS, 0);
+    for (int i = 0; i < count; i++) {
+        // A device can only go away while it's being read, after which it isn't touched again
+        TouchScreenDevice *device = static_cast<TouchScreenDevice *>(ready[i].data.ptr);
+        if (device->inputThread()) {
+            readQueuedSamples(device);
+        } else {
+            readRawEvents(device);
+        }
+    }
+    flushUi();
+}
+
+/**
+ * @brief Reads raw events from a touchscreen when available and parses them
+ * @param device The touchscreen
+ */
+void CalibrationWindow::readRawEvents(TouchScreenDevice *device)
+{
+    // Pull events out in batches until the kernel has nothing left for us
+    EventReader &reader = device->eventReader();
+    reader.beginWakeup();
+    int count;
+    while ((count = reader.readBatch(device->fd())) > 0) {
+        // Every frame in the batch is handled in this one pass
+        timeval const handleTime = _latency.now();
+        input_event const *events = reader.events();
+        if (device == _recording) {
+            _recorder.write(events, count);
+        }
+        for (int i = 0; i < count; i++) {
+            // Each time the decoder sees a syn report, we have a full sample to process
+            if (device->decoder().processEvent(events[i])) {
+                TouchSample sample = device->decoder().sample();
+                sample.readTime = reader.readTime();
+                handleTouchUpdate(device, sample, handleTime);
             }
         }
-    } while (result == sizeof(input_event));
+
+        // A short read means the kernel buffer is drained, so don't waste a
+        // syscall just to be told EAGAIN. The notifier will fire again if more arrive.
+        if (count < EVENT_BATCH_SIZE) {
+            break;
+        }
+    }
+    int const error = errno;
+    reader.endWakeup();
+
+    // The device was unplugged or the driver unbound; wait for it to come back
+    if (count < 0 && error == ENODEV) {
+        detachTouchScreen(device);
+    }
+}
+
+/**
+ * @brief Processes samples that a touchscreen's input thread has decoded and queued for us
+ * @param device The touchscreen
+ */
+void CalibrationWindow::readQueuedSamples(TouchScreenDevice *device)
+{
+    // Clear the notification first so anything queued while we drain wakes us up again
+    InputThread *thread = device->inputThread();
+    thread->acknowledge();
+
+    timeval const handleTime = _latency.now();
+    TouchSample sample;
+    while (thread->takeSample(sample)) {
+        handleTouchUpdate(device, sample, handleTime);
+    }
 }
 
 /**
  * @brief Called when a complete touch state update arrives
- * @param xy The last known touch location
- * @param pressed True if the screen is touched, false if not
+ * @param device The touchscreen it came from
+ * @param sample The decoded touch state, with its kernel and read timestamps
+ * @param handleTime When the batch of frames it arrived in started being handled
+ *
+ * Only the touch state and calibration are updated here. Anything that shows
+ * on the screen, or saves, is queued up for flushUi() so a burst of frames
+ * only causes it once.
  */
-void CalibrationWindow::handleTouchUpdate(QPoint xy, bool pressed)
+void CalibrationWindow::handleTouchUpdate(TouchScreenDevice *device, TouchSample const &sample,
+                                          timeval const &handleTime)
 {
-    bool touchJustPressed = false;
-    bool touchJustReleased = false;
+    _latency.record(LatencyStats::KernelToRead, sample.time, sample.readTime);
+    _latency.record(LatencyStats::ReadToHandle, sample.readTime, handleTime);
 
-    // If the touchscreen was released and now it's pressed, mark as such
-    if (pressed && !_touchIsPressed)
-    {
-        _touchIsPressed = true;
-        touchJustPressed = true;
+    // Each touchscreen keeps track of its own presses, so tapping any of them
+    // works once calibration is over
+    bool const justPressed = sample.pressed && !device->isPressed();
+    bool const justReleased = !sample.pressed && device->isPressed();
+    device->setPressed(sample.pressed);
+
+    if (_checkingProfile) {
+        handleTapCheckSample(device, sample, justPressed, justReleased);
+        return;
     }
-    // Same idea if it was pressed and now it's released
-    else if (!pressed && _touchIsPressed)
-    {
-        _touchIsPressed = false;
-        touchJustReleased = true;
+    if (_verifying) {
+        handleVerificationSample(device, sample, justPressed, justReleased, handleTime);
+        return;
     }
-
-    // As long as we are still calibrating, add the latest point to the queue
-    if (_curCalPoint < NUM_CAL_POINTS)
-    {
-        _points.enqueue(xy);
-        // Limit the queue size
-        if (_points.count() > MAX_AVG_POINTS) {
-            _points.dequeue();
+    if (_done) {
+        // A fixture doesn't confirm anything
+        if (justPressed && !sample.resynced && !_scripted) {
+            _finishPending = true;
         }
+        return;
+    }
 
-        // If the touchscreen was just released, save the calibration point we're on
-        if (touchJustReleased)
-        {
-            int x = 0, y = 0, count = 0;
-            // Dequeue all of the points and average them up
-            while (!_points.isEmpty())
-            {
-                QPoint p = _points.dequeue();
-                x += p.x();
-                y += p.y();
-                count++;
-            }
-            x = qRound(static_cast<float>(x) / static_cast<float>(count));
-            y = qRound(static_cast<float>(y) / static_cast<float>(count));
-            _calibrationPoints.append(QPoint(x, y));
-
-            // Move onto the next phase
-            _curCalPoint++;
-            update();
-
-            if (_curCalPoint == NUM_CAL_POINTS) {
-
-                // Do some math to figure out the cal points. Cheesy, but we have two samples of each
-                // X and Y point, so figure them out by averaging. This is not a super great way of
-                // calibrating a touchscreen, but it works okay for the Chumby 8.
-                float leftXCal = (_calibrationPoints[0].x() + _calibrationPoints[3].x()) / 2.0f;
-                float rightXCal = (_calibrationPoints[1].x() + _calibrationPoints[2].x()) / 2.0f;
-                float topYCal = (_calibrationPoints[0].y() + _calibrationPoints[1].y()) / 2.0f;
-                float botYCal = (_calibrationPoints[2].y() + _calibrationPoints[3].y()) / 2.0f;
-
-                // Here are their corresponding points in pixels
-                float leftXPixels = _crosshairPoints[0].x();
-                float rightXPixels = _crosshairPoints[1].x();
-                float topYPixels = _crosshairPoints[0].y();
-                float botYPixels = _crosshairPoints[2].y();
-
-                // Calculate scale of original units to screen pixels
-                float scaleX = (rightXCal - leftXCal) / (rightXPixels - leftXPixels);
-                float scaleY = (botYCal - topYCal) / (botYPixels - topYPixels);
-
-                // Now use the scale to extrapolate the min and max original points.
-                _minXCal = leftXCal - (scaleX * CROSSHAIR_OFFSET);
-                _maxXCal = rightXCal + (scaleX * CROSSHAIR_OFFSET);
-                _minYCal = topYCal - (scaleY * CROSSHAIR_OFFSET);
-                _maxYCal = botYCal + (scaleY * CROSSHAIR_OFFSET);
-
-                // Make sure they're in range (if not, something's wrong...)
-                if (_minXCal < 0 || _maxXCal > RAW_TOUCHSCREEN_RANGE ||
-                    _minYCal < 0 || _maxYCal > RAW_TOUCHSCREEN_RANGE ||
-                    _minXCal > _maxXCal ||
-                    _minYCal > _maxYCal) {
-                    _instructionsLabel.setText("Calibration error. Tap the screen to quit.");
-                    _calibrationPoints.clear();
-                } else {
-                    _instructionsLabel.setText("Calibration complete. Tap the screen to apply and save.");
-                }
+    // Only the touchscreen being calibrated counts until it's done
+    if (device != _calibrating) {
+        return;
+    }
+    if (justPressed && _firstTouchSeconds < 0 && !_telemetryFile.isEmpty()) {
+        _firstTouchSeconds = ProcessStats::secondsSinceStart();
+    }
 
-            }
+    Calibrator::Result const result = _calibrator.handleTouchUpdate(sample);
+    if (_scripted && result != Calibrator::NoChange && result != Calibrator::PressedWhenDone) {
+        int const point = _calibrator.currentPoint() - 1;
+        QPoint const raw = _calibrator.samples().at(point);
+        scriptReport("point %d %d %d %d %d\n", _results.length() + 1, point, raw.x(), raw.y(),
+                     _calibrator.pointStats(point).samples);
+    }
+
+    switch (result) {
+    case Calibrator::NoChange:
+        break;
+    case Calibrator::PointCaptured:
+        // Move onto the next crosshair
+        scheduleUpdate(handleTime);
+        announceTarget();
+        break;
+    case Calibrator::CalibrationSucceeded:
+        deviceCalibrated(handleTime);
+        break;
+    case Calibrator::CalibrationFailed:
+        recordTelemetry();
+        scheduleUpdate(handleTime);
+        _done = true;
+        _haveUnsavedCalibration = false;
+        setInstructions("Calibration error. Tap the screen to quit.");
+        if (_scripted) {
+            finishScript(false, failureNames[_calibrator.failure()]);
+        }
+        break;
+    case Calibrator::PressedWhenDone:
+        break;
+    }
+}
+
+/**
+ * @brief Called when the touchscreen being calibrated has had all of its points tapped
+ * @param handleTime When the touch that finished it was handled, for timing the repaint
+ */
+void CalibrationWindow::deviceCalibrated(timeval const &handleTime)
+{
+    scheduleUpdate(handleTime);
+    for (int i = 0; i < _calibrator.targets().length(); i++) {
+        qDebug("Calibration point %d: error %.2f pixels", i, static_cast<double>(_calibrator.residual(i)));
+    }
+    if (_scripted) {
+        QByteArray line = "calibrated " + QByteArray::number(_results.length() + 1) + " " +
+                          QByteArray::number(_calibrator.maxResidual(), 'f', 2);
+        for (int i = 0; i < _calibrator.targets().length(); i++) {
+            line += " " + QByteArray::number(_calibrator.residual(i), 'f', 2);
         }
+        scriptReport("%s\n", line.constData());
     }
+
+    recordTelemetry();
+    DeviceCalibration result;
+    result.identity = _calibrating->identity();
+    result.path = _calibrating->path();
+    result.axes = _calibrator.axes();
+    result.matrix = _calibrator.matrix();
+    _results.append(result);
+    if (_calibrator.isAffine()) {
+        _maxResidual = qMax(_maxResidual, _calibrator.maxResidual());
+    }
+    _haveCalibratingIdentity = false;
+    _calibrating = nullptr;
+
+    // On to the next touchscreen, if there's another one
+    chooseNextDevice();
+    if (_calibrating) {
+        setInstructions(QString("Touchscreen %1 done. ").arg(_results.length()) + instructions());
+        return;
+    }
+
+    _done = true;
+    _haveUnsavedCalibration = true;
+    _crosshairRect = QRect();
+    if (_scripted) {
+        // No confirming tap; the fixture is told whether it worked instead
+        _finishPending = true;
+    } else if (_verify) {
+        startVerification();
+    } else if (!_calibrator.isAffine()) {
+        setInstructions("Calibration complete. Tap the screen to apply and save.");
+    } else {
+        setInstructions(QString("Calibration complete (largest error %1 pixels). "
+                                "Tap the screen to apply and save.")
+                        .arg(static_cast<double>(_maxResidual), 0, 'f', 1));
+    }
+}
+
+/**
+ * @brief Called after the screen is tapped once calibration is over, or right away in scripted mode
+ *
+ * This is deferred to flushUi(), so saving and applying to X happen once the
+ * touch frames that asked for it have all been handled.
+ */
+void CalibrationWindow::finishCalibration()
+{
     // If they just pressed the screen for the first time after calibration finished
     // (or an error occurred), exit. Save as long as we have something to save and it
     // wasn't an error.
-    else if (touchJustPressed)
-    {
-        // Save and apply the new calibration if we just finished
-        if (_calibrationPoints.length() == NUM_CAL_POINTS) {
-            // Assemble the calibration matrix. This is a 3x3 matrix that will
-            // translate a vector [x, y, 1] from normalized [0...1] raw touchscreen x/y coordinates
-            // to normalized [0...1] screen x/y coordinates. The coordinates we receive will be
-            // the raw touchscreen 0-4095 coordinates, but normalized to 0.0-1.0 instead.
-            //
-            // Note: This is currently implemented as a very simplistic calibration. It doesn't
-            // support any kind of rotation or skewing. So it assumes that all we have to do is
-            // scale and translate the X and Y coordinates in order to calibrate.. This seems to
-            // work decently enough for the Chumby 8's touchscreen. If rotation was needed, we
-            // would need to use a more complicated method for creating the calibration matrix.
-            float const rangeF = static_cast<float>(RAW_TOUCHSCREEN_RANGE);
-            float a = rangeF / (_maxXCal - _minXCal);
-            float c = _minXCal / (_minXCal - _maxXCal);
-            float e = rangeF / (_maxYCal - _minYCal);
-            float f = _minYCal / (_minYCal - _maxYCal);
-            QVector<float> calibrationMatrix = QVector<float>(
-                {a,    0.0f, c,
-                 0.0f, e,    f,
-                 0.0f, 0.0f, 1.0f});
-
-            if (!CalibrationUtils::saveNewCalibration(calibrationMatrix)) {
-                _instructionsLabel.setText("Error saving calibration. Tap the screen to quit.");
-            } else if (!CalibrationUtils::applyCalibration(calibrationMatrix)) {
-                _instructionsLabel.setText("Error applying final calibration. Tap the screen to quit.");
+    if (_haveUnsavedCalibration) {
+        bool applied;
+        bool const saved = saveResults(applied);
+        if (!saved) {
+            setInstructions("Error saving calibration. Tap the screen to quit.");
+        } else {
+            setInstructions(applied ?
+                            "New calibration saved and applied successfully. Tap the screen to finish." :
+                            "Error applying final calibration. Tap the screen to quit.");
+        }
+        // The next tap will quit
+        _haveUnsavedCalibration = false;
+        if (_scripted) {
+            finishScript(saved && applied, saved ? "apply-failed" : "save-failed");
+        }
+    } else {
+        // They're tapping after a message was displayed that will quit. So quit.
+        // X can have the touchscreens back right away rather than after the
+        // window is torn down.
+        releaseTouchScreens();
+        qApp->exit();
+    }
+}
+
+/**
+ * @brief Saves the calibrations from this run and applies them to X
+ * @param applied Set to true if every one of them was applied
+ * @return True if they were saved
+ */
+bool CalibrationWindow::saveResults(bool &applied)
+{
+    applied = false;
+    double const saveStart = _telemetryFile.isEmpty() ? -1 : ProcessStats::secondsSinceStart();
+    bool const saved = CalibrationUtils::saveNewCalibration(_results);
+    if (saved) {
+        // With just one touchscreen, whichever one X has is it
+        applied = true;
+        for (DeviceCalibration const &result : _results) {
+            CalibrationSession session(_results.length() > 1 ? result.path : QString());
+            bool const ok = session.apply(result.matrix);
+            applied = ok && applied;
+            for (TelemetryRecord &record : _telemetry) {
+                if (Telemetry::matches(record, result.identity)) {
+                    record.flags |= ok ? (TelemetrySaved | TelemetryApplied) : TelemetrySaved;
+                }
+            }
+        }
+    }
+    if (!_telemetryFile.isEmpty()) {
+        double const saveEnd = ProcessStats::secondsSinceStart();
+        for (TelemetryRecord &record : _telemetry) {
+            record.phaseMilliseconds[ReviewPhase] = Telemetry::elapsedMilliseconds(_calibratedSeconds, saveStart);
+            record.phaseMilliseconds[SavePhase] = Telemetry::elapsedMilliseconds(saveStart, saveEnd);
+        }
+    }
+    return saved;
+}
+
+/**
+ * @brief Switches to letting the user draw on the screen with the new calibrations
+ *
+ * Everything is drawn into an image that persists for the rest of the run, so
+ * each new touch sample only has to draw one short segment into it and copy
+ * that little area to the screen. A touch that's still down when this starts
+ * isn't drawn, since only new presses start a trail.
+ */
+void CalibrationWindow::startVerification()
+{
+    _verifying = true;
+    _trailDevice = nullptr;
+    buildTransforms();
+
+    _verifyImage = QImage(size(), QImage::Format_RGB32);
+    _verifyImage.fill(Qt::white);
+    QPainter p(&_verifyImage);
+    p.setPen(QPen(Qt::gray, 1.0f));
+    for (QPoint const &target : _calibrator.targets()) {
+        drawCrosshair(p, target);
+    }
+
+    setInstructions("Draw or tap the crosshairs to check the calibration. Tap here to save.");
+    _layoutPending = true;
+    queueRepaint(QRect(QPoint(), size()));
+}
+
+/**
+ * @brief Draws a touch sample while verifying the calibration
+ * @param device The touchscreen it came from
+ * @param sample The decoded touch state
+ * @param justPressed True if this is the first sample of a touch
+ * @param justReleased True if the touch was just lifted
+ * @param handleTime When the sample was handled, for timing the repaint
+ */
+void CalibrationWindow::handleVerificationSample(TouchScreenDevice *device, TouchSample const &sample,
+                                                 bool justPressed, bool justReleased, timeval const &handleTime)
+{
+    // Events were lost, so don't join the trail up across the gap. It picks up
+    // again on the next press.
+    if (sample.resynced) {
+        if (_trailDevice == device) {
+            _trailDevice = nullptr;
+        }
+        return;
+    }
+
+    // One trail at a time; another touchscreen has to wait for it to finish
+    if (_trailDevice && _trailDevice != device) {
+        return;
+    }
+
+    // Use this touchscreen's own calibration
+    int const index = resultIndex(device->identity());
+    if (index < 0) {
+        return;
+    }
+    QPointF const point = _verifyTransforms[index].map(sample.xy);
+
+    if (justPressed) {
+        // Tapping the instructions is how they say they're happy with it
+        QRect const saveArea = _instructionsLabel.geometry().adjusted(0, -VERIFY_SAVE_MARGIN, 0, VERIFY_SAVE_MARGIN);
+        if (saveArea.contains(point.toPoint())) {
+            _verifying = false;
+            _layoutPending = true;
+            queueRepaint(QRect(QPoint(), size()));
+            _finishPending = true;
+            return;
+        }
+        _trailDevice = device;
+        _lastTrailPoint = point;
+    }
+
+    if (_trailDevice != device) {
+        return;
+    }
+
+    QPainter p(&_verifyImage);
+    if (sample.pressed) {
+        // Add just the new segment of the trail. The release sample is skipped
+        // because its location is often wild at lift-off.
+        p.setPen(QPen(Qt::blue, TRAIL_WIDTH, Qt::SolidLine, Qt::RoundCap));
+        p.drawLine(_lastTrailPoint, point);
+        queueRepaint(QRectF(_lastTrailPoint, point).normalized().toAlignedRect()
+                     .adjusted(-TRAIL_WIDTH, -TRAIL_WIDTH, TRAIL_WIDTH, TRAIL_WIDTH));
+        _lastTrailPoint = point;
+        markPaintPending(handleTime);
+    } else if (justReleased) {
+        _trailDevice = nullptr;
+
+        // If the trail ended on a target, show how far off it was
+        PointSpan const targets = _calibrator.targets();
+        int nearest = -1;
+        double nearestDistance = VERIFY_TARGET_RADIUS;
+        for (int i = 0; i < targets.length(); i++) {
+            QPointF const delta = _lastTrailPoint - targets[i];
+            double const distance = std::sqrt(delta.x() * delta.x() + delta.y() * delta.y());
+            if (distance <= nearestDistance) {
+                nearest = i;
+                nearestDistance = distance;
+            }
+        }
+        if (nearest < 0) {
+            return;
+        }
+
+        // Put the readout on the side of the target toward the middle of the screen
+        QPoint const &target = targets[nearest];
+        int const x = target.x() < width() / 2 ? target.x() + CROSSHAIR_SIZE : target.x() - CROSSHAIR_SIZE - VERIFY_LABEL_WIDTH;
+        int const y = target.y() < height() / 2 ? target.y() + CROSSHAIR_SIZE : target.y() - CROSSHAIR_SIZE - VERIFY_LABEL_HEIGHT;
+        QRect const readout(x, y, VERIFY_LABEL_WIDTH, VERIFY_LABEL_HEIGHT);
+        QString const text = QString("%1 px").arg(nearestDistance, 0, 'f', 1);
+        p.fillRect(readout, Qt::white);
+#ifdef CHUMBY8TSCAL_LITE
+        // The lite build never loads a font, so the readout uses the same glyphs as the instructions
+        GlyphLabel::drawText(p, readout, text);
+#else
+        p.setPen(Qt::black);
+        p.drawText(readout, Qt::AlignCenter, text);
+#endif
+        queueRepaint(readout);
+        markPaintPending(handleTime);
+    }
+}
+
+/**
+ * @brief Prepares a transform for each calibration, to see where touches will end up
+ */
+void CalibrationWindow::buildTransforms()
+{
+    _verifyTransforms.clear();
+    for (DeviceCalibration const &result : _results) {
+        _verifyTransforms.append(CalibrationTransform(result.matrix.constData(), result.axes,
+                                                      _calibrator.screenSize()));
+    }
+}
+
+/**
+ * @brief Switches to checking imported calibrations with a single tap per touchscreen
+ * @param profile The calibrations that were imported, already applied but not saved
+ */
+void CalibrationWindow::startTapCheck(QList<DeviceCalibration> const &profile)
+{
+    // There's nothing left to calibrate, so no touchscreen gets picked for it
+    _checkingProfile = true;
+    _done = true;
+    _results = profile;
+    _profileChecked = QVector<bool>(profile.length(), false);
+    buildTransforms();
+
+    QSize const &screenSize = _calibrator.screenSize();
+    _crosshairRect = crosshairRect(QPoint(screenSize.width() / 2, screenSize.height() / 2));
+    queueRepaint(_crosshairRect);
+    if (profile.length() > 1) {
+        setInstructions("Tap the crosshair once with each touchscreen to check the imported calibration.");
+    } else {
+        setInstructions("Tap the crosshair to check the imported calibration.");
+    }
+}
+
+/**
+ * @brief Measures a check tap on the crosshair
+ * @param device The touchscreen it came from
+ * @param sample The decoded touch state
+ * @param justPressed True if this is the first sample of a touch
+ * @param justReleased True if the touch was just lifted
+ *
+ * The tap's position is the average of its samples, skipping the same ones
+ * calibration would, so that a wild first or last frame doesn't fail a good
+ * profile.
+ */
+void CalibrationWindow::handleTapCheckSample(TouchScreenDevice *device, TouchSample const &sample,
+                                             bool justPressed, bool justReleased)
+{
+    if (_checkFinished) {
+        if (justPressed && !sample.resynced) {
+            releaseTouchScreens();
+            qApp->exit(_exitCode);
+        }
+        return;
+    }
+
+    int const index = resultIndex(device->identity());
+    if (index < 0 || sample.resynced) {
+        // Events were lost partway through, so this tap can't be trusted
+        if (_checkDevice == device) {
+            _checkDevice = nullptr;
+        }
+        return;
+    }
+
+    if (justPressed) {
+        _checkDevice = device;
+        _checkFrames = 0;
+        _checkSum = QPointF();
+        _checkCount = 0;
+    }
+    if (_checkDevice != device) {
+        return;
+    }
+
+    if (sample.pressed) {
+        _checkFrames++;
+        if (_checkFrames > _pressureGate.settleFrames &&
+            (sample.pressure < 0 || sample.pressure >= _pressureGate.minPressure)) {
+            _checkSum += _verifyTransforms[index].map(sample.xy);
+            _checkCount++;
+        }
+        return;
+    }
+    if (!justReleased) {
+        return;
+    }
+
+    // Too short or light to measure; they can just tap again
+    _checkDevice = nullptr;
+    if (_checkCount == 0) {
+        return;
+    }
+
+    QPointF const delta = _checkSum / _checkCount - QPointF(_crosshairRect.center());
+    float const error = std::sqrt(delta.x() * delta.x() + delta.y() * delta.y());
+    qDebug("Check tap on touchscreen %d: error %.2f pixels", index + 1, static_cast<double>(error));
+    if (error > _tapTolerance) {
+        finishTapCheck(false, QString("The tap was %1 pixels off, over the limit of %2. The profile was not "
+                                      "saved; calibrate this unit instead. Tap the screen to quit.")
+                       .arg(static_cast<double>(error), 0, 'f', 1).arg(static_cast<double>(_tapTolerance)));
+        return;
+    }
+
+    _profileChecked[index] = true;
+    _maxResidual = qMax(_maxResidual, error);
+    if (_profileChecked.contains(false)) {
+        setInstructions(QString("Touchscreen %1 is within %2 pixels. Now tap the crosshair with the next one.")
+                        .arg(index + 1).arg(static_cast<double>(error), 0, 'f', 1));
+        return;
+    }
+
+    if (!CalibrationUtils::saveNewCalibration(_results)) {
+        finishTapCheck(false, "Error saving calibration. Tap the screen to quit.");
+        return;
+    }
+    finishTapCheck(true, QString("Imported calibration checked (largest error %1 pixels) and saved. "
+                                 "Tap the screen to finish.")
+                   .arg(static_cast<double>(_maxResidual), 0, 'f', 1));
+}
+
+/**
+ * @brief Reports the outcome of checking an imported profile
+ * @param passed True if it was checked and saved
+ * @param message What to tell the user
+ *
+ * A profile that doesn't pass was already applied to X by the time it was
+ * checked, so whatever was saved before is put back.
+ */
+void CalibrationWindow::finishTapCheck(bool passed, QString const &message)
+{
+    _checkFinished = true;
+    _exitCode = passed ? EXIT_SUCCESS : EXIT_FAILURE;
+    queueRepaint(_crosshairRect);
+    _crosshairRect = QRect();
+    setInstructions(message);
+
+    QList<DeviceCalibration> previous;
+    if (!passed && CalibrationUtils::loadSavedCalibration(previous)) {
+        for (DeviceCalibration const &calibration : previous) {
+            CalibrationSession session(calibration.path);
+            session.apply(calibration.matrix);
+        }
+    }
+}
+
+/**
+ * @brief Tells the fixture which crosshair to tap next, in scripted mode
+ */
+void CalibrationWindow::announceTarget()
+{
+    if (!_scripted || _scriptFinished || !_calibrating || !_calibrator.isCollecting()) {
+        return;
+    }
+    int const point = _calibrator.currentPoint();
+    QPoint const target = _calibrator.targets().at(point);
+    scriptReport("target %d %d %d %d\n", _results.length() + 1, point, target.x(), target.y());
+}
+
+/**
+ * @brief Reads and carries out commands from the fixture in scripted mode
+ *
+ * Commands are one per line:
+ * - abort: give up, reporting a failure
+ * - restart: start the touchscreen being calibrated over from its first crosshair
+ * - target: repeat the current target
+ */
+void CalibrationWindow::readScriptCommands()
+{
+    char buffer[SCRIPT_MAX_LINE];
+    ssize_t const length = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (length <= 0) {
+        // If the fixture closed its end (or nothing is connected), carry on without commands
+        if (length == 0 || (errno != EAGAIN && errno != EINTR)) {
+            _scriptNotifier->setEnabled(false);
+        }
+        return;
+    }
+
+    _scriptInput.append(buffer, static_cast<int>(length));
+    int end;
+    while (!_scriptFinished && (end = _scriptInput.indexOf('\n')) >= 0) {
+        QByteArray const command = _scriptInput.left(end).trimmed();
+        _scriptInput.remove(0, end + 1);
+        if (command == "abort") {
+            finishScript(false, "aborted");
+        } else if (command == "restart") {
+            if (_done) {
+                scriptReport("error finished\n");
             } else {
-                _instructionsLabel.setText("New calibration saved and applied successfully. Tap the screen to finish.");
+                // Forgetting which one was partway through makes it start from scratch
+                _haveCalibratingIdentity = false;
+                chooseNextDevice();
             }
-            // Clear calibration points so the next tap will quit
-            _calibrationPoints.clear();
+        } else if (command == "target") {
+            announceTarget();
+        } else if (!command.isEmpty()) {
+            scriptReport("error unknown-command\n");
+        }
+    }
+    if (_scriptInput.length() > SCRIPT_MAX_LINE) {
+        _scriptInput.clear();
+        scriptReport("error line-too-long\n");
+    }
+    flushUi();
+}
+
+/**
+ * @brief Reports the result to the fixture and quits, in scripted mode
+ * @param passed True if every touchscreen was calibrated, saved and applied
+ * @param reason Why it didn't pass, as one word
+ *
+ * The program exits with a status to match, once the event loop is running.
+ */
+void CalibrationWindow::finishScript(bool passed, char const *reason)
+{
+    if (_scriptFinished) {
+        return;
+    }
+    _scriptFinished = true;
+    _exitCode = passed ? EXIT_SUCCESS : EXIT_FAILURE;
+    if (passed) {
+        scriptReport("result pass\n");
+    } else {
+        scriptReport("result fail %s\n", reason);
+    }
+    if (_scriptNotifier) {
+        _scriptNotifier->setEnabled(false);
+    }
+    QTimer::singleShot(0, this, &CalibrationWindow::quitScript);
+}
+
+/**
+ * @brief Leaves the event loop with the scripted mode's exit status
+ */
+void CalibrationWindow::quitScript()
+{
+    releaseTouchScreens();
+    qApp->exit(_exitCode);
+}
+
+/**
+ * @brief Starts a telemetry record for the touchscreen being calibrated, if telemetry is on
+ *
+ * This is called once it's finished, whether it worked or not, or when the
+ * program quits partway through. Input statistics and latency are added at
+ * the end, when the input threads have stopped.
+ */
+void CalibrationWindow::recordTelemetry()
+{
+    if (_telemetryFile.isEmpty() || !_haveCalibratingIdentity) {
+        return;
+    }
+
+    TelemetryRecord record;
+    Telemetry::describe(record, _calibratingIdentity, _calibrator);
+    _calibratedSeconds = ProcessStats::secondsSinceStart();
+    record.phaseMilliseconds[StartupPhase] = Telemetry::elapsedMilliseconds(0, _startupSeconds);
+    if (_firstTouchSeconds >= 0) {
+        // Nobody can tap anything before the first frame is up
+        double const waitStart = qMax(_waitStartSeconds, _startupSeconds);
+        record.phaseMilliseconds[WaitPhase] = Telemetry::elapsedMilliseconds(waitStart, _firstTouchSeconds);
+        record.phaseMilliseconds[TapPhase] = Telemetry::elapsedMilliseconds(_firstTouchSeconds, _calibratedSeconds);
+    }
+    _telemetry.append(record);
+}
+
+/**
+ * @brief Adds a touchscreen's input statistics to its telemetry records
+ * @param device The touchscreen, whose input thread (if any) has stopped
+ */
+void CalibrationWindow::addDeviceTelemetry(TouchScreenDevice const *device)
+{
+    for (TelemetryRecord &record : _telemetry) {
+        if (Telemetry::matches(record, device->identity())) {
+            device->addTelemetry(record);
+        }
+    }
+}
+
+/**
+ * @brief Changes the instructions the next time the UI is flushed
+ * @param text The new instructions
+ */
+void CalibrationWindow::setInstructions(QString const &text)
+{
+    _pendingInstructions = text;
+    _instructionsPending = true;
+}
+
+/**
+ * @brief Gets the instructions, including a change that hasn't been flushed yet
+ * @return The instructions
+ */
+QString CalibrationWindow::instructions() const
+{
+    return _instructionsPending ? _pendingInstructions : _instructionsLabel.text();
+}
+
+/**
+ * @brief Adds an area to be repainted the next time the UI is flushed
+ * @param rect The area
+ */
+void CalibrationWindow::queueRepaint(QRect const &rect)
+{
+    _pendingRepaint += rect;
+}
+
+/**
+ * @brief Does the UI work that has been queued up since the last flush
+ *
+ * Touch handling only queues up its effects on the screen, so however many
+ * frames came in at once, the label changes (and gets laid out) at most once,
+ * there's one repaint request, and saving happens once. Everything that's
+ * called from the event loop flushes when it's done.
+ */
+void CalibrationWindow::flushUi()
+{
+    // Saving can change the instructions, so it goes first
+    if (_finishPending) {
+        _finishPending = false;
+        finishCalibration();
+    }
+    if (_instructionsPending) {
+        _instructionsPending = false;
+        if (_pendingInstructions != _instructionsLabel.text()) {
+            _instructionsLabel.setText(_pendingInstructions);
+        }
+    }
+    if (_layoutPending) {
+        _layoutPending = false;
+        layoutInstructions();
+    }
+    if (!_pendingRepaint.isEmpty()) {
+        update(_pendingRepaint);
+        _pendingRepaint = QRegion();
+    }
+}
+
+/**
+ * @brief Remembers when a touch asked for a repaint, so the paint can be timed
+ * @param handleTime When the touch that caused the repaint was handled
+ */
+void CalibrationWindow::markPaintPending(timeval const &handleTime)
+{
+    // If a repaint is already on its way, it's late for the earlier touch
+    if (!_paintPending) {
+        _paintRequestTime = handleTime;
+        _paintPending = true;
+    }
+}
+
+/**
+ * @brief Moves the crosshair after a touch, and remembers when so the paint can be timed
+ * @param handleTime When the touch that caused the repaint was handled
+ */
+void CalibrationWindow::scheduleUpdate(timeval const &handleTime)
+{
+    markPaintPending(handleTime);
+
+    // Only the old and new crosshairs need to be redrawn
+    queueRepaint(_crosshairRect);
+    if (_calibrator.isCollecting()) {
+        _crosshairRect = crosshairRect(_calibrator.targets().at(_calibrator.currentPoint()));
+        queueRepaint(_crosshairRect);
+    } else {
+        _crosshairRect = QRect();
+    }
+}
+
+/**
+ * @brief Figures out the area covered by a crosshair
+ * @param center The center of the crosshair
+ * @return The rectangle the crosshair is drawn in
+ */
+QRect CalibrationWindow::crosshairRect(QPoint const &center)
+{
+    // The lines run from -CROSSHAIR_SIZE/2 to +CROSSHAIR_SIZE/2 inclusive
+    return QRect(center.x() - CROSSHAIR_SIZE/2, center.y() - CROSSHAIR_SIZE/2,
+                 CROSSHAIR_SIZE + 1, CROSSHAIR_SIZE + 1);
+}
+
+/**
+ * @brief Draws a crosshair
+ * @param p The painter to draw with, already set up with the pen to use
+ * @param center The center of the crosshair
+ */
+void CalibrationWindow::drawCrosshair(QPainter &p, QPoint const &center)
+{
+    p.drawLine(center.x() - CROSSHAIR_SIZE/2, center.y(),
+               center.x() + CROSSHAIR_SIZE/2, center.y());
+    p.drawLine(center.x(), center.y() - CROSSHAIR_SIZE/2,
+               center.x(), center.y() + CROSSHAIR_SIZE/2);
+}
+
+/**
+ * @brief Arranges for DUMP_STATISTICS_SIGNAL to print the statistics, and for
+ *        SIGINT and SIGTERM to quit cleanly
+ *
+ * Almost nothing is safe to do in a signal handler, so the handler just writes
+ * the signal number to a socket that the event loop is watching. Quitting
+ * through the event loop means the destructor still runs, so the statistics
+ * are printed and the touchscreen grab is released in an orderly way. The quit
+ * signals go back to their default after the first one, so a second Ctrl-C
+ * still works if the event loop is stuck.
+ */
+void CalibrationWindow::setupSignals()
+{
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, signalFds) < 0) {
+        qCritical("Unable to create signal socket");
+        return;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = signalHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(DUMP_STATISTICS_SIGNAL, &action, nullptr) < 0) {
+        qCritical("Unable to install statistics signal handler");
+        ::close(signalFds[0]);
+        ::close(signalFds[1]);
+        signalFds[0] = signalFds[1] = -1;
+        return;
+    }
+    action.sa_flags = SA_RESTART | SA_RESETHAND;
+    if (sigaction(SIGINT, &action, nullptr) < 0 || sigaction(SIGTERM, &action, nullptr) < 0) {
+        qCritical("Unable to install quit signal handlers");
+    }
+
+    _signalNotifier = new QSocketNotifier(signalFds[0], QSocketNotifier::Read, this);
+    connect(_signalNotifier, &QSocketNotifier::activated, this, &CalibrationWindow::handleSignal);
+}
+
+/**
+ * @brief Deals with a signal that the handler passed along to the event loop
+ */
+void CalibrationWindow::handleSignal()
+{
+    char signum;
+    if (::read(signalFds[0], &signum, sizeof(signum)) != sizeof(signum)) {
+        return;
+    }
+
+    if (signum != DUMP_STATISTICS_SIGNAL) {
+        // The fixture still gets a result, and a failing exit status
+        if (_scripted) {
+            finishScript(false, "aborted");
         } else {
-            // They're tapping after a message was displayed that will quit. So quit.
-            qApp->exit();
+            qApp->quit();
         }
+        return;
     }
+
+    // An input thread's own statistics can't be read while it's running
+    for (TouchScreenDevice const *device : _devices) {
+        if (!device->inputThread()) {
+            device->logStatistics();
+        }
+    }
+    _latency.logStatistics();
+}
+
+/**
+ * @brief Signal handler that passes the signal along to handleSignal()
+ * @param signum The signal that arrived
+ */
+void CalibrationWindow::signalHandler(int signum)
+{
+    char const value = static_cast<char>(signum);
+    ssize_t result = ::write(signalFds[1], &value, sizeof(value));
+    Q_UNUSED(result);
 }
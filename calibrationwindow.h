@@ -19,20 +19,57 @@
 #ifndef CALIBRATIONWINDOW_H
 #define CALIBRATIONWINDOW_H
 
-#include <QMainWindow>
-#include <QLabel>
+#include <QImage>
+#include <QList>
+#include <QRegion>
 #include <QSocketNotifier>
-#include <QQueue>
+#include <QVector>
+#include "calibrationoptions.h"
+#include "calibrationtransform.h"
+#include "calibrationutils.h"
+#include "calibrator.h"
+#include "capturefile.h"
+#include "devicewatcher.h"
+#include "latencystats.h"
+#include "telemetry.h"
+#include "touchidentity.h"
+#include "touchscreendevice.h"
+
+#ifdef CHUMBY8TSCAL_LITE
+#include "glyphlabel.h"
+#include "litewindow.h"
+
+/// The lite build draws into a bare QWindow, with text from a built-in glyph set
+typedef LiteWindow CalibrationWindowBase;
+typedef QWindow CalibrationWindowParent;
+typedef GlyphLabel InstructionsLabel;
+#else
+#include <QLabel>
+#include <QMainWindow>
+
+typedef QMainWindow CalibrationWindowBase;
+typedef QWidget CalibrationWindowParent;
+typedef QLabel InstructionsLabel;
+#endif
 
 /**
  * @brief Window used for calibrating the Chumby 8's touchscreen
+ *
+ * Every touchscreen that's found is read at once, through a single epoll
+ * descriptor. They're calibrated one after another in the same pass, each
+ * with its own crosshairs, and all of the results are saved together.
+ *
+ * Touch frames only update the touch and calibration state as they're handled.
+ * Whatever they change on the screen (the instructions, repaints, and saving
+ * and applying the result) is queued up and done once per pass through the
+ * event loop, however many frames arrived.
  */
-class CalibrationWindow : public QMainWindow
+class CalibrationWindow : public CalibrationWindowBase
 {
     Q_OBJECT
 
 public:
-    CalibrationWindow(QWidget *parent = nullptr);
+    CalibrationWindow(CalibrationOptions const &options, CalibrationWindowParent *parent = nullptr);
     ~CalibrationWindow();
 
 protected:
@@ -40,23 +77,111 @@ protected:
     void resizeEvent(QResizeEvent *);
 
 private:
-    void readRawEvents();
-    void handleTouchUpdate(QPoint xy, bool pressed);
-
-    QLabel _instructionsLabel;
-    QList<QPoint> _crosshairPoints;
-    QList<QPoint> _calibrationPoints;
-    int _curCalPoint;
-    int _calibrationFd;
-    QSocketNotifier *_calibrationNotifier;
-    bool _tmpPressed;
-    QPoint _tmpXY;
-    bool _touchIsPressed;
-    QQueue<QPoint> _points;
-
-    float _minXCal;
-    float _maxXCal;
-    float _minYCal;
-    float _maxYCal;
+    void attachTouchScreen(int fd, QString const &path);
+    void detachTouchScreen(TouchScreenDevice *device);
+    void releaseTouchScreens();
+    void touchScreenAdded(QString const &path);
+    void touchScreenRemoved(QString const &path);
+    bool isCalibrated(TouchIdentity const &identity) const;
+    int resultIndex(TouchIdentity const &identity) const;
+    void chooseNextDevice();
+    void layoutInstructions();
+    void readDevices();
+    void readRawEvents(TouchScreenDevice *device);
+    void readQueuedSamples(TouchScreenDevice *device);
+    void handleTouchUpdate(TouchScreenDevice *device, TouchSample const &sample, timeval const &handleTime);
+    void deviceCalibrated(timeval const &handleTime);
+    void finishCalibration();
+    bool saveResults(bool &applied);
+    void startVerification();
+    void handleVerificationSample(TouchScreenDevice *device, TouchSample const &sample,
+                                  bool justPressed, bool justReleased, timeval const &handleTime);
+    void buildTransforms();
+    void startTapCheck(QList<DeviceCalibration> const &profile);
+    void handleTapCheckSample(TouchScreenDevice *device, TouchSample const &sample,
+                              bool justPressed, bool justReleased);
+    void finishTapCheck(bool passed, QString const &message);
+    void announceTarget();
+    void readScriptCommands();
+    void finishScript(bool passed, char const *reason);
+    void quitScript();
+    void recordTelemetry();
+    void addDeviceTelemetry(TouchScreenDevice const *device);
+    void setInstructions(QString const &text);
+    QString instructions() const;
+    void queueRepaint(QRect const &rect);
+    void flushUi();
+    void markPaintPending(timeval const &handleTime);
+    void scheduleUpdate(timeval const &handleTime);
+    static QRect crosshairRect(QPoint const &center);
+    static void drawCrosshair(QPainter &p, QPoint const &center);
+    void setupSignals();
+    void handleSignal();
+    static void signalHandler(int signum);
+
+    InstructionsLabel _instructionsLabel;
+    int _numPoints;
+    PressureGate _pressureGate;
+    Calibrator _calibrator;
+    QRect _crosshairRect;
+    DeviceWatcher *_deviceWatcher;
+    QList<TouchScreenDevice *> _devices;
+    int _epollFd;
+    QSocketNotifier *_epollNotifier;
+    bool _useInputThread;
+    bool _exclusive;
+    QString _recordFile;
+    CaptureWriter _recorder;
+    TouchScreenDevice *_recording;
+    TouchIdentity _recordingIdentity;
+    LatencyStats _latency;
+    bool _paintPending;
+    bool _painted;
+    timeval _paintRequestTime;
+    QString _pendingInstructions;
+    bool _instructionsPending;
+    bool _layoutPending;
+    QRegion _pendingRepaint;
+    bool _finishPending;
+    QSocketNotifier *_signalNotifier;
+
+    TouchScreenDevice *_calibrating;
+    TouchIdentity _calibratingIdentity;
+    bool _haveCalibratingIdentity;
+    QList<DeviceCalibration> _results;
+    float _maxResidual;
+    bool _done;
+    bool _haveUnsavedCalibration;
+
+    bool _verify;
+    bool _verifying;
+    QImage _verifyImage;
+    QVector<CalibrationTransform> _verifyTransforms;
+    TouchScreenDevice *_trailDevice;
+    QPointF _lastTrailPoint;
+
+    bool _checkingProfile;
+    float _tapTolerance;
+    QVector<bool> _profileChecked;
+    TouchScreenDevice *_checkDevice;
+    int _checkFrames;
+    QPointF _checkSum;
+    int _checkCount;
+    bool _checkFinished;
+    int _exitCode;
+
+    bool _scripted;
+    bool _scriptFinished;
+    QSocketNotifier *_scriptNotifier;
+    QByteArray _scriptInput;
+
+    QString _telemetryFile;
+    qint64 _telemetryLimit;
+    QVector<TelemetryRecord> _telemetry;
+    double _startupSeconds;
+    double _waitStartSeconds;
+    double _firstTouchSeconds;
+    double _calibratedSeconds;
 };
+
 #endif // CALIBRATIONWINDOW_H
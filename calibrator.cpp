@@ -0,0 +1,357 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calibrator.h"
+#include "calibrationmath.h"
+#include <algorithm>
+#include <cmath>
+
+/// Largest remaining error (in pixels) allowed at any point for a full affine calibration
+#define MAX_AFFINE_RESIDUAL             15.0f
+/// How steady a touch has to be before it's taken: standard deviation as a fraction
+/// of the axis range (about 8 raw units on a 0-4095 axis), or the driver's fuzz if bigger
+#define MAX_SAMPLE_STDDEV_FRACTION      0.002f
+
+/**
+ * @brief Constructor for Calibrator
+ * @param numPoints The number of calibration points: 4, 5 or 9
+ * @param screenSize The size of the screen in pixels
+ */
+Calibrator::Calibrator(int numPoints, QSize const &screenSize) :
+    _screenSize(screenSize),
+    _numPoints(0),
+    _affine(false),
+    _curCalPoint(0),
+    _touchIsPressed(false),
+    _waitingForRelease(false),
+    _touchFrames(0),
+    _gatedSamples(0),
+    _maxSampleStdDevX(0),
+    _maxSampleStdDevY(0),
+    _maxResidual(0),
+    _failure(NoFailure),
+    _minXCal(0),
+    _maxXCal(0),
+    _minYCal(0),
+    _maxYCal(0)
+{
+    timerclear(&_touchStart);
+    _residuals.fill(0);
+    switch (numPoints) {
+    case fivePointLayout.NumPoints:
+        useLayout(fivePointLayout);
+        break;
+    case gridLayout.NumPoints:
+        useLayout(gridLayout);
+        break;
+    default:
+        useLayout(cornerLayout);
+        break;
+    }
+    setAxes(TouchAxes());
+}
+
+/**
+ * @brief Places the crosshairs for a calibration layout
+ * @param layout The layout
+ */
+template <int N>
+void Calibrator::useLayout(CalibrationLayout<N> const &layout)
+{
+    _numPoints = N;
+    _affine = layout.affine;
+    for (int i = 0; i < N; i++) {
+        _crosshairPoints[i] = layoutTarget(layout.points[i], _screenSize);
+    }
+}
+
+/**
+ * @brief Tells the calibrator about the touchscreen's actual raw ranges
+ * @param axes The ranges reported by the driver
+ *
+ * Until this is called, both axes are assumed to go from 0 to RAW_TOUCHSCREEN_RANGE.
+ */
+void Calibrator::setAxes(TouchAxes const &axes)
+{
+    _axes = axes;
+
+    // Anything within the driver's fuzz is noise it would have filtered anyway,
+    // so there's no point in waiting for the touch to be steadier than that
+    _maxSampleStdDevX = qMax(MAX_SAMPLE_STDDEV_FRACTION * _axes.x.span(), static_cast<float>(_axes.x.fuzz));
+    _maxSampleStdDevY = qMax(MAX_SAMPLE_STDDEV_FRACTION * _axes.y.span(), static_cast<float>(_axes.y.fuzz));
+}
+
+/**
+ * @brief Called when a complete touch state update arrives
+ * @param sample The decoded touch state
+ * @return What happened as a result of this update
+ */
+Calibrator::Result Calibrator::handleTouchUpdate(TouchSample const &sample)
+{
+    bool const pressed = sample.pressed;
+
+    // Part of the touch in progress is missing, so it can't be trusted for a
+    // point. Still pressed counts as a fresh press; released just ends it.
+    if (sample.resynced) {
+        abandonTouch();
+    }
+
+    bool touchJustPressed = false;
+    bool touchJustReleased = false;
+
+    // If the touchscreen was released and now it's pressed, mark as such
+    if (pressed && !_touchIsPressed)
+    {
+        _touchIsPressed = true;
+        touchJustPressed = true;
+    }
+    // Same idea if it was pressed and now it's released
+    else if (!pressed && _touchIsPressed)
+    {
+        _touchIsPressed = false;
+        touchJustReleased = true;
+    }
+
+    // If this tap's point was already taken, ignore the rest of it
+    if (_waitingForRelease) {
+        if (touchJustReleased) {
+            _waitingForRelease = false;
+        }
+        return NoChange;
+    }
+
+    // Once we're done calibrating, all that matters is when the screen is pressed
+    if (!isCollecting()) {
+        return touchJustPressed ? PressedWhenDone : NoChange;
+    }
+
+    if (pressed) {
+        // Collect samples until they settle down, then take the point right away
+        if (touchJustPressed) {
+            _accumulator.reset();
+            _touchFrames = 0;
+            _touchStart = sample.time;
+        }
+
+        // Skip the edges of the tap, where the panel isn't being pressed firmly yet
+        _touchFrames++;
+        if (_touchFrames <= _gate.settleFrames ||
+            (sample.pressure >= 0 && sample.pressure < _gate.minPressure)) {
+            _gatedSamples++;
+            _pointStats[_curCalPoint].rejected++;
+            return NoChange;
+        }
+        _accumulator.add(sample.xy);
+        _pointStats[_curCalPoint].samples++;
+        if (!_accumulator.isStable(_maxSampleStdDevX, _maxSampleStdDevY)) {
+            return NoChange;
+        }
+        _waitingForRelease = true;
+        return capturePoint(_accumulator.result(), sample.time);
+    }
+
+    // Released before the touch settled; make do with what we have. The
+    // release itself isn't added because the location is often wild at lift-off.
+    if (!touchJustReleased || _accumulator.count() == 0) {
+        return NoChange;
+    }
+    return capturePoint(_accumulator.result(), sample.time);
+}
+
+/**
+ * @brief Throws away the touch in progress, as if the screen had never been pressed
+ *
+ * Use this when the touch state can no longer be trusted, such as when the
+ * touchscreen disappears. Whatever was collected for the current point is
+ * dropped rather than being taken as a short tap.
+ */
+void Calibrator::abandonTouch()
+{
+    _touchIsPressed = false;
+    _waitingForRelease = false;
+    _accumulator.reset();
+}
+
+/**
+ * @brief Saves the calibration point we're on and moves onto the next one
+ * @param point The filtered raw location of the touch
+ * @param time The timestamp of the sample that completed it
+ * @return What happened as a result
+ */
+Calibrator::Result Calibrator::capturePoint(QPoint const &point, timeval const &time)
+{
+    _calibrationPoints[_curCalPoint] = point;
+    PointStats &stats = _pointStats[_curCalPoint];
+    _accumulator.stdDev(stats.stdDevX, stats.stdDevY);
+    stats.milliseconds = static_cast<long>(time.tv_sec - _touchStart.tv_sec) * 1000L +
+                         static_cast<long>(time.tv_usec - _touchStart.tv_usec) / 1000L;
+    _accumulator.reset();
+
+    // Move onto the next phase
+    _curCalPoint++;
+    if (isCollecting()) {
+        return PointCaptured;
+    }
+
+    bool ok;
+    switch (_numPoints) {
+    case fivePointLayout.NumPoints:
+        ok = calculateAffineCalibration<fivePointLayout.NumPoints>();
+        break;
+    case gridLayout.NumPoints:
+        ok = calculateAffineCalibration<gridLayout.NumPoints>();
+        break;
+    default:
+        ok = calculateCornerCalibration();
+        break;
+    }
+    if (!ok) {
+        _calibrationMatrix.clear();
+        return CalibrationFailed;
+    }
+    return CalibrationSucceeded;
+}
+
+/**
+ * @brief Calculates a scale and translation calibration from the four corner points
+ * @return True on success, false if the results don't make sense
+ */
+bool Calibrator::calculateCornerCalibration()
+{
+    // Do some math to figure out the cal points. Cheesy, but we have two samples of each
+    // X and Y point, so figure them out by averaging. This is not a super great way of
+    // calibrating a touchscreen, but it works okay for the Chumby 8.
+    float leftXCal = (_calibrationPoints[TopLeftCorner].x() + _calibrationPoints[BottomLeftCorner].x()) / 2.0f;
+    float rightXCal = (_calibrationPoints[TopRightCorner].x() + _calibrationPoints[BottomRightCorner].x()) / 2.0f;
+    float topYCal = (_calibrationPoints[TopLeftCorner].y() + _calibrationPoints[TopRightCorner].y()) / 2.0f;
+    float botYCal = (_calibrationPoints[BottomRightCorner].y() + _calibrationPoints[BottomLeftCorner].y()) / 2.0f;
+
+    // Here are their corresponding points in pixels
+    float leftXPixels = _crosshairPoints[TopLeftCorner].x();
+    float rightXPixels = _crosshairPoints[TopRightCorner].x();
+    float topYPixels = _crosshairPoints[TopLeftCorner].y();
+    float botYPixels = _crosshairPoints[BottomRightCorner].y();
+
+    // Calculate scale of original units to screen pixels
+    float scaleX = (rightXCal - leftXCal) / (rightXPixels - leftXPixels);
+    float scaleY = (botYCal - topYCal) / (botYPixels - topYPixels);
+
+    // Now use the scale to extrapolate the min and max original points.
+    _minXCal = leftXCal - (scaleX * CROSSHAIR_OFFSET);
+    _maxXCal = rightXCal + (scaleX * CROSSHAIR_OFFSET);
+    _minYCal = topYCal - (scaleY * CROSSHAIR_OFFSET);
+    _maxYCal = botYCal + (scaleY * CROSSHAIR_OFFSET);
+
+    // Make sure they're in range (if not, something's wrong...)
+    if (_minXCal < _axes.x.minimum || _maxXCal > _axes.x.maximum ||
+        _minYCal < _axes.y.minimum || _maxYCal > _axes.y.maximum ||
+        _minXCal > _maxXCal ||
+        _minYCal > _maxYCal) {
+        _failure = OutOfRange;
+        return false;
+    }
+
+    // Assemble the calibration matrix. This is a 3x3 matrix that will
+    // translate a vector [x, y, 1] from normalized [0...1] raw touchscreen x/y coordinates
+    // to normalized [0...1] screen x/y coordinates. The coordinates we receive will be
+    // the raw touchscreen coordinates, but normalized from the axis range to 0.0-1.0.
+    //
+    // Note: This is a very simplistic calibration. It doesn't support any kind of
+    // rotation or skewing. So it assumes that all we have to do is scale and translate
+    // the X and Y coordinates in order to calibrate. This seems to work decently enough
+    // for the Chumby 8's touchscreen. Use more calibration points to get the full
+    // affine calculation in calculateAffineCalibration() if rotation is needed.
+    float a = _axes.x.span() / (_maxXCal - _minXCal);
+    float c = (_minXCal - _axes.x.minimum) / (_minXCal - _maxXCal);
+    float e = _axes.y.span() / (_maxYCal - _minYCal);
+    float f = (_minYCal - _axes.y.minimum) / (_minYCal - _maxYCal);
+    _calibrationMatrix = QVector<float>(
+        {a,    0.0f, c,
+         0.0f, e,    f,
+         0.0f, 0.0f, 1.0f});
+
+    // Keep track of how far off each corner still is, for reporting
+    _maxResidual = 0;
+    for (int i = 0; i < NumCorners; i++) {
+        QPointF const error = CalibrationMath::mapToScreen(_calibrationMatrix.constData(), _calibrationPoints[i],
+                                                           _axes, _screenSize) - _crosshairPoints[i];
+        _residuals[i] = static_cast<float>(std::sqrt(error.x() * error.x() + error.y() * error.y()));
+        _maxResidual = qMax(_maxResidual, _residuals[i]);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Calculates a full affine calibration (including rotation and skew) from all of the points
+ * @return True on success, false if the results don't make sense
+ */
+template <int N>
+bool Calibrator::calculateAffineCalibration()
+{
+    static_assert(N <= MAX_CAL_POINTS, "Layout has more points than there's room for");
+    std::array<QPoint, N> raw;
+    std::array<QPoint, N> screen;
+    std::array<float, N> residuals;
+    std::copy_n(_calibrationPoints.begin(), N, raw.begin());
+    std::copy_n(_crosshairPoints.begin(), N, screen.begin());
+    float matrix[9];
+
+    if (!CalibrationMath::solveAffine(raw, screen, _axes, _screenSize, matrix, residuals)) {
+        _failure = SolveFailed;
+        return false;
+    }
+
+    std::copy(residuals.begin(), residuals.end(), _residuals.begin());
+    _maxResidual = *std::max_element(residuals.begin(), residuals.end());
+    if (_maxResidual > MAX_AFFINE_RESIDUAL) {
+        _failure = ResidualTooLarge;
+        return false;
+    }
+
+    // Just like the four-corner calculation, the whole screen has to be reachable
+    // within the touchscreen's raw ranges, or something's wrong. The extremes
+    // are kept the same way too, for telemetry.
+    QPoint const corners[4] = {
+        QPoint(0, 0), QPoint(_screenSize.width(), 0),
+        QPoint(0, _screenSize.height()), QPoint(_screenSize.width(), _screenSize.height())
+    };
+    for (int i = 0; i < 4; i++) {
+        float rawX, rawY;
+        if (!CalibrationMath::mapToRaw(matrix, corners[i], _axes, _screenSize, rawX, rawY)) {
+            _failure = SolveFailed;
+            return false;
+        }
+        _minXCal = i == 0 ? rawX : qMin(_minXCal, rawX);
+        _maxXCal = i == 0 ? rawX : qMax(_maxXCal, rawX);
+        _minYCal = i == 0 ? rawY : qMin(_minYCal, rawY);
+        _maxYCal = i == 0 ? rawY : qMax(_maxYCal, rawY);
+    }
+    if (_minXCal < _axes.x.minimum || _maxXCal > _axes.x.maximum ||
+        _minYCal < _axes.y.minimum || _maxYCal > _axes.y.maximum) {
+        _failure = OutOfRange;
+        return false;
+    }
+
+    _calibrationMatrix = QVector<float>(9);
+    for (int i = 0; i < 9; i++) {
+        _calibrationMatrix[i] = matrix[i];
+    }
+
+    return true;
+}
@@ -0,0 +1,183 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALIBRATOR_H
+#define CALIBRATOR_H
+
+#include <QPoint>
+#include <QSize>
+#include <QVector>
+#include <array>
+#include "calibrationlayout.h"
+#include "sampleaccumulator.h"
+#include "touchaxes.h"
+#include "touchdecoder.h"
+
+/**
+ * @brief Which samples of a touch are good enough to calibrate with
+ *
+ * Resistive panels are light and wildly off at the start and end of a tap, so
+ * samples can be ignored until the touch has been down for a few frames, and
+ * whenever the pressure is too light. Pressure is only checked if the
+ * touchscreen reports it.
+ */
+struct PressureGate
+{
+    PressureGate() :
+        minPressure(0),
+        settleFrames(0)
+    {
+    }
+
+    /// Lightest raw pressure accepted (0 accepts anything)
+    int minPressure;
+    /// Number of frames to ignore at the start of each touch
+    int settleFrames;
+};
+
+/**
+ * @brief How the touches for one calibration point went, for telemetry
+ */
+struct PointStats
+{
+    PointStats() :
+        samples(0),
+        rejected(0),
+        stdDevX(0),
+        stdDevY(0),
+        milliseconds(0)
+    {
+    }
+
+    /// Samples collected for this point, over every touch it took
+    int samples;
+    /// Samples ignored by the pressure gate
+    int rejected;
+    /// Spread of the raw samples it was taken from
+    float stdDevX;
+    float stdDevY;
+    /// From the start of the touch it was taken from until it was taken
+    long milliseconds;
+};
+
+/**
+ * @brief The calibration process itself, independent of how it's displayed
+ *
+ * Feed it every touch sample; it works out when each crosshair has been tapped,
+ * filters the samples, and calculates the calibration matrix once all of the
+ * points are in. A point is taken as soon as the touch holds steady, without
+ * waiting for the finger to lift. It doesn't need a screen or X, so recorded touchscreen data
+ * can be replayed through it.
+ *
+ * The layout is picked when it's constructed, from the ones in calibrationlayout.h.
+ * Points are kept in fixed-size arrays, and each layout's math is its own
+ * template instance, so nothing is allocated until the final matrix.
+ */
+class Calibrator
+{
+public:
+    /// What happened as a result of a touch update
+    enum Result
+    {
+        /// Nothing worth reacting to
+        NoChange,
+        /// A calibration point was captured, and there are more to go
+        PointCaptured,
+        /// The last point was captured and the calibration matrix is ready
+        CalibrationSucceeded,
+        /// The last point was captured, but the results don't make sense
+        CalibrationFailed,
+        /// The screen was pressed after the calibration was already finished
+        PressedWhenDone
+    };
+
+    /// Why the calibration failed
+    enum Failure
+    {
+        /// It didn't, or it hasn't finished yet
+        NoFailure,
+        /// The points don't determine a matrix, such as when they're all in a line
+        SolveFailed,
+        /// The matrix misses one of the points by more than MAX_AFFINE_RESIDUAL
+        ResidualTooLarge,
+        /// Part of the screen would be outside of the touchscreen's raw ranges
+        OutOfRange
+    };
+
+    Calibrator(int numPoints, QSize const &screenSize);
+
+    void setAxes(TouchAxes const &axes);
+    void setPressureGate(PressureGate const &gate) { _gate = gate; }
+    Result handleTouchUpdate(TouchSample const &sample);
+    void abandonTouch();
+
+    bool isCollecting() const { return _curCalPoint < _numPoints; }
+    QSize const &screenSize() const { return _screenSize; }
+    TouchAxes const &axes() const { return _axes; }
+    int currentPoint() const { return _curCalPoint; }
+    PointSpan targets() const { return PointSpan(_crosshairPoints.data(), _numPoints); }
+    PointSpan samples() const { return PointSpan(_calibrationPoints.data(), _curCalPoint); }
+    QVector<float> const &matrix() const { return _calibrationMatrix; }
+    float residual(int point) const { return _residuals[point]; }
+    float maxResidual() const { return _maxResidual; }
+    Failure failure() const { return _failure; }
+    PointStats const &pointStats(int point) const { return _pointStats[point]; }
+    float minXCal() const { return _minXCal; }
+    float maxXCal() const { return _maxXCal; }
+    float minYCal() const { return _minYCal; }
+    float maxYCal() const { return _maxYCal; }
+    unsigned long gatedSamples() const { return _gatedSamples; }
+    bool isAffine() const { return _affine; }
+
+private:
+    template <int N>
+    void useLayout(CalibrationLayout<N> const &layout);
+    Result capturePoint(QPoint const &point, timeval const &time);
+    bool calculateCornerCalibration();
+    template <int N>
+    bool calculateAffineCalibration();
+
+    QSize _screenSize;
+    TouchAxes _axes;
+    int _numPoints;
+    bool _affine;
+    std::array<QPoint, MAX_CAL_POINTS> _crosshairPoints;
+    std::array<QPoint, MAX_CAL_POINTS> _calibrationPoints;
+    int _curCalPoint;
+    bool _touchIsPressed;
+    bool _waitingForRelease;
+    PressureGate _gate;
+    int _touchFrames;
+    timeval _touchStart;
+    unsigned long _gatedSamples;
+    std::array<PointStats, MAX_CAL_POINTS> _pointStats;
+    SampleAccumulator _accumulator;
+    float _maxSampleStdDevX;
+    float _maxSampleStdDevY;
+    QVector<float> _calibrationMatrix;
+    std::array<float, MAX_CAL_POINTS> _residuals;
+    float _maxResidual;
+    Failure _failure;
+
+    float _minXCal;
+    float _maxXCal;
+    float _minYCal;
+    float _maxYCal;
+};
+
+#endif // CALIBRATOR_H
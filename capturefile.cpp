@@ -0,0 +1,182 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "capturefile.h"
+#include "eventreader.h"
+#include <string.h>
+
+/// Identifies a capture file
+#define CAPTURE_MAGIC                   "C8TSCAP"
+/// Current version of the capture file format
+#define CAPTURE_VERSION                 2
+/// Size of the header in version 1 capture files, which didn't record the axis ranges
+#define CAPTURE_V1_HEADER_SIZE          16
+
+static_assert(sizeof(CaptureHeader) == 40, "CaptureHeader must not contain padding");
+static_assert(sizeof(CaptureRecord) == 16, "CaptureRecord must not contain padding");
+
+/**
+ * @brief Creates a new capture file
+ * @param path The file to create
+ * @param calibrationPoints The number of calibration points being used, for replaying
+ * @param screenSize The size of the screen, for replaying
+ * @param axes The touchscreen's raw ranges, for replaying
+ * @return True on success, false on failure
+ */
+bool CaptureWriter::open(QString const &path, int calibrationPoints, QSize const &screenSize, TouchAxes const &axes)
+{
+    CaptureHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    header.version = CAPTURE_VERSION;
+    header.calibrationPoints = static_cast<quint16>(calibrationPoints);
+    header.screenWidth = static_cast<quint16>(screenSize.width());
+    header.screenHeight = static_cast<quint16>(screenSize.height());
+    header.xMinimum = axes.x.minimum;
+    header.xMaximum = axes.x.maximum;
+    header.xFuzz = axes.x.fuzz;
+    header.yMinimum = axes.y.minimum;
+    header.yMaximum = axes.y.maximum;
+    header.yFuzz = axes.y.fuzz;
+
+    _file.setFileName(path);
+    if (!_file.open(QFile::WriteOnly | QFile::Truncate)) {
+        qCritical("Unable to create capture file");
+        return false;
+    }
+    if (_file.write(reinterpret_cast<char const *>(&header), sizeof(header)) != sizeof(header)) {
+        qCritical("Unable to write capture file");
+        _file.close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Appends raw events to the capture file
+ * @param events The events that were just read
+ * @param count The number of events
+ */
+void CaptureWriter::write(input_event const *events, int count)
+{
+    CaptureRecord records[EVENT_BATCH_SIZE];
+    while (count > 0) {
+        int const chunk = qMin(count, EVENT_BATCH_SIZE);
+        for (int i = 0; i < chunk; i++) {
+            records[i].seconds = static_cast<quint32>(events[i].time.tv_sec);
+            records[i].microseconds = static_cast<quint32>(events[i].time.tv_usec);
+            records[i].type = events[i].type;
+            records[i].code = events[i].code;
+            records[i].value = events[i].value;
+        }
+        _file.write(reinterpret_cast<char const *>(records), chunk * static_cast<qint64>(sizeof(CaptureRecord)));
+        events += chunk;
+        count -= chunk;
+    }
+}
+
+/**
+ * @brief Finishes writing the capture file
+ */
+void CaptureWriter::close()
+{
+    _file.close();
+}
+
+/**
+ * @brief Opens an existing capture file and reads its header
+ * @param path The file to open
+ * @return True on success, false if it can't be opened or isn't a capture file
+ */
+bool CaptureReader::open(QString const &path)
+{
+    _file.setFileName(path);
+    if (!_file.open(QFile::ReadOnly)) {
+        qCritical("Unable to open capture file");
+        return false;
+    }
+
+    // The start of the header is the same in every version
+    char *header = reinterpret_cast<char *>(&_header);
+    if (_file.read(header, CAPTURE_V1_HEADER_SIZE) != CAPTURE_V1_HEADER_SIZE ||
+        memcmp(_header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) ||
+        _header.version < 1 || _header.version > CAPTURE_VERSION) {
+        qCritical("Not a supported capture file");
+        _file.close();
+        return false;
+    }
+
+    // Version 1 didn't record the axes, so they stay at the defaults
+    _axes = TouchAxes();
+    if (_header.version >= 2) {
+        qint64 const rest = static_cast<qint64>(sizeof(_header)) - CAPTURE_V1_HEADER_SIZE;
+        if (_file.read(header + CAPTURE_V1_HEADER_SIZE, rest) != rest) {
+            qCritical("Capture file header is truncated");
+            _file.close();
+            return false;
+        }
+        _axes.x.minimum = _header.xMinimum;
+        _axes.x.maximum = _header.xMaximum;
+        _axes.x.fuzz = _header.xFuzz;
+        _axes.y.minimum = _header.yMinimum;
+        _axes.y.maximum = _header.yMaximum;
+        _axes.y.fuzz = _header.yFuzz;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Reads the next events from the capture file
+ * @param events Filled in with the events
+ * @param maxEvents The size of the events array
+ * @return The number of events read, 0 at the end of the file
+ */
+int CaptureReader::read(input_event *events, int maxEvents)
+{
+    int count = 0;
+    CaptureRecord record;
+    while (count < maxEvents &&
+           _file.read(reinterpret_cast<char *>(&record), sizeof(record)) == sizeof(record)) {
+        input_event &event = events[count++];
+        event.time.tv_sec = record.seconds;
+        event.time.tv_usec = record.microseconds;
+        event.type = record.type;
+        event.code = record.code;
+        event.value = record.value;
+    }
+    return count;
+}
+
+/**
+ * @brief Reads all remaining events from the capture file into memory
+ * @return The events
+ */
+QVector<input_event> CaptureReader::readAll()
+{
+    QVector<input_event> events;
+    input_event batch[EVENT_BATCH_SIZE];
+    int count;
+    while ((count = read(batch, EVENT_BATCH_SIZE)) > 0) {
+        for (int i = 0; i < count; i++) {
+            events.append(batch[i]);
+        }
+    }
+    return events;
+}
@@ -0,0 +1,100 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAPTUREFILE_H
+#define CAPTUREFILE_H
+
+#include <QFile>
+#include <QSize>
+#include <QVector>
+#include <linux/input.h>
+#include "touchaxes.h"
+
+/**
+ * @brief Header at the start of a capture file
+ *
+ * Capture files are a CaptureHeader followed by any number of CaptureRecords,
+ * all little-endian. The records have a fixed layout, unlike input_event whose
+ * size depends on the architecture, so a capture made on the Chumby can be
+ * replayed on a PC and vice versa.
+ *
+ * Version 1 files end after screenHeight, and were always 0-4095 on both axes.
+ */
+struct CaptureHeader
+{
+    char magic[8];
+    quint16 version;
+    quint16 calibrationPoints;
+    quint16 screenWidth;
+    quint16 screenHeight;
+    // Added in version 2
+    qint32 xMinimum;
+    qint32 xMaximum;
+    qint32 xFuzz;
+    qint32 yMinimum;
+    qint32 yMaximum;
+    qint32 yFuzz;
+};
+
+/**
+ * @brief One raw input event in a capture file
+ */
+struct CaptureRecord
+{
+    quint32 seconds;
+    quint32 microseconds;
+    quint16 type;
+    quint16 code;
+    qint32 value;
+};
+
+/**
+ * @brief Writes raw touchscreen events to a capture file as they're read
+ */
+class CaptureWriter
+{
+public:
+    bool open(QString const &path, int calibrationPoints, QSize const &screenSize, TouchAxes const &axes);
+    bool isOpen() const { return _file.isOpen(); }
+    void write(input_event const *events, int count);
+    void close();
+
+private:
+    QFile _file;
+};
+
+/**
+ * @brief Reads raw touchscreen events back out of a capture file
+ */
+class CaptureReader
+{
+public:
+    bool open(QString const &path);
+    int calibrationPoints() const { return _header.calibrationPoints; }
+    QSize screenSize() const { return QSize(_header.screenWidth, _header.screenHeight); }
+    TouchAxes const &axes() const { return _axes; }
+    int read(input_event *events, int maxEvents);
+    QVector<input_event> readAll();
+
+private:
+    QFile _file;
+    CaptureHeader _header;
+    TouchAxes _axes;
+};
+
+#endif // CAPTUREFILE_H
@@ -0,0 +1,98 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "devicewatcher.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructor for DeviceWatcher
+ * @param parent The parent object
+ *
+ * Check isValid() afterward; if inotify isn't available, nothing will ever be reported.
+ */
+DeviceWatcher::DeviceWatcher(QObject *parent) :
+    QObject(parent),
+    _fd(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+    _notifier(nullptr)
+{
+    if (_fd < 0) {
+        qCritical("Unable to create inotify instance");
+        return;
+    }
+
+    if (::inotify_add_watch(_fd, INPUT_DEVICE_DIR, IN_CREATE | IN_ATTRIB | IN_MOVED_TO |
+                            IN_DELETE | IN_MOVED_FROM) < 0) {
+        qCritical("Unable to watch %s for input devices", INPUT_DEVICE_DIR);
+        ::close(_fd);
+        _fd = -1;
+        return;
+    }
+
+    _notifier = new QSocketNotifier(_fd, QSocketNotifier::Read, this);
+    connect(_notifier, &QSocketNotifier::activated, this, &DeviceWatcher::readNotifications);
+}
+
+/**
+ * @brief Destructor for DeviceWatcher
+ */
+DeviceWatcher::~DeviceWatcher()
+{
+    if (_fd >= 0) {
+        delete _notifier;
+        ::close(_fd);
+    }
+}
+
+/**
+ * @brief Reads whatever inotify has for us and reports the event nodes involved
+ */
+void DeviceWatcher::readNotifications()
+{
+    // inotify_event has to be aligned, and it's variable-length because of the name
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    for (;;) {
+        ssize_t const length = ::read(_fd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                qCritical("Error reading inotify events");
+            }
+            return;
+        }
+
+        for (char const *p = buffer; p < buffer + length; ) {
+            inotify_event const *event = reinterpret_cast<inotify_event const *>(p);
+            p += sizeof(inotify_event) + event->len;
+
+            // Only evdev nodes matter; ignore mice, js*, by-id/ and so on
+            if (event->len == 0 || strncmp(event->name, "event", 5) != 0 || (event->mask & IN_ISDIR)) {
+                continue;
+            }
+
+            QString const path = QStringLiteral(INPUT_DEVICE_DIR "/") + QString::fromLocal8Bit(event->name);
+            if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                emit deviceRemoved(path);
+            } else {
+                emit deviceAdded(path);
+            }
+        }
+    }
+}
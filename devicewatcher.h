@@ -0,0 +1,59 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEVICEWATCHER_H
+#define DEVICEWATCHER_H
+
+#include <QObject>
+#include <QSocketNotifier>
+#include <QString>
+
+/// Directory where the kernel (or udev) creates input device nodes
+#define INPUT_DEVICE_DIR                "/dev/input"
+
+/**
+ * @brief Watches /dev/input for event nodes coming and going, using inotify
+ *
+ * Nothing is polled; the inotify descriptor is watched with a QSocketNotifier
+ * and only the node named in each notification is reported. A node is reported
+ * as added both when it's created and when its attributes change, because udev
+ * usually creates the node before it fixes up the permissions, so the first
+ * attempt to open it can fail.
+ */
+class DeviceWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    DeviceWatcher(QObject *parent = nullptr);
+    ~DeviceWatcher();
+
+    bool isValid() const { return _fd >= 0; }
+
+signals:
+    void deviceAdded(QString const &path);
+    void deviceRemoved(QString const &path);
+
+private:
+    void readNotifications();
+
+    int _fd;
+    QSocketNotifier *_notifier;
+};
+
+#endif // DEVICEWATCHER_H
@@ -0,0 +1,579 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "driftdaemon.h"
+#include "calibrationmath.h"
+#include "calibrationsession.h"
+#include "calibrationutils.h"
+#include "driftestimator.h"
+#include "sampleaccumulator.h"
+#include "touchscreendevice.h"
+#include <QStringList>
+#include <cmath>
+#include <cstdlib>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/// Niceness to run at, so the UI the daemon is watching always comes first
+#define DRIFT_NICENESS                  10
+/// How much each new tap discounts the older ones; about the last 200 taps count
+#define DRIFT_FORGETTING_FACTOR         0.995
+/// Starting covariance, in normalized units. The saved calibration is a good start, so it's
+/// smallish; a few dozen taps are enough to follow a drift of a couple of percent.
+#define DRIFT_INITIAL_COVARIANCE        0.1
+/// Taps needed before the estimate is trusted enough to apply
+#define DRIFT_MIN_SAMPLES               10
+/// Longest time (in milliseconds) between a tap ending and its target arriving
+#define DRIFT_PAIR_WINDOW_MS            500
+/// Taps landing further than this (in pixels) from their target were probably aimed elsewhere
+#define DRIFT_MAX_TARGET_DISTANCE       40.0f
+/// A tap moving more than this fraction of the axis range is a drag, not a tap
+#define DRIFT_MAX_TAP_STDDEV_FRACTION   0.005f
+/// Largest message a client can send
+#define DRIFT_MESSAGE_SIZE              64
+
+/**
+ * @brief Everything the daemon tracks for one touchscreen
+ */
+struct DriftDevice
+{
+    DriftDevice(int fd, QString const &path) :
+        touchScreen(fd, path),
+        session(nullptr),
+        saved(-1),
+        tapFrames(0),
+        haveTap(false),
+        updates(0),
+        rejected(0)
+    {
+        memset(applied, 0, sizeof(applied));
+        memset(&tapTime, 0, sizeof(tapTime));
+    }
+
+    TouchScreenDevice touchScreen;
+    /// What X was told to use for this touchscreen
+    QString sessionPath;
+    CalibrationSession *session;
+    DriftEstimator estimator;
+    /// Which of the saved calibrations this touchscreen was loaded from
+    int saved;
+    /// The matrix X currently has
+    float applied[9];
+    SampleAccumulator tap;
+    int tapFrames;
+    /// True if a tap just ended and hasn't been paired with a target yet
+    bool haveTap;
+    QPoint tapPoint;
+    timeval tapTime;
+    unsigned long updates;
+    unsigned long rejected;
+};
+
+/// Socket pair the signal handler uses to wake up the poll loop
+static int signalFds[2] = {-1, -1};
+
+/**
+ * @brief Constructor for DriftDaemon
+ * @param socketPath Where to receive targets from clients
+ * @param threshold How far (in pixels) the estimate has to move a touch before it's applied
+ * @param gate Which samples of each tap to use
+ */
+DriftDaemon::DriftDaemon(QString const &socketPath, float threshold, PressureGate const &gate) :
+    _socketPath(socketPath),
+    _threshold(threshold),
+    _gate(gate),
+    _socket(-1)
+{
+}
+
+/**
+ * @brief Destructor for DriftDaemon
+ */
+DriftDaemon::~DriftDaemon()
+{
+    for (DriftDevice *device : _devices) {
+        delete device->session;
+        delete device;
+    }
+    if (_socket >= 0) {
+        ::close(_socket);
+        ::unlink(_socketPath.toUtf8().constData());
+    }
+    if (signalFds[0] >= 0) {
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        ::close(signalFds[0]);
+        ::close(signalFds[1]);
+        signalFds[0] = signalFds[1] = -1;
+    }
+}
+
+/**
+ * @brief Runs until SIGINT or SIGTERM, or until every touchscreen is gone
+ * @return The process exit code
+ */
+int DriftDaemon::run()
+{
+    if (setpriority(PRIO_PROCESS, 0, DRIFT_NICENESS) < 0) {
+        qDebug("Unable to lower the drift daemon's priority");
+    }
+
+    if (!openDevices() || !openSocket() || !setupSignals()) {
+        return EXIT_FAILURE;
+    }
+
+    pollfd fds[MAX_CALIBRATION_RECORDS + 2];
+    for (;;) {
+        if (_devices.isEmpty()) {
+            qCritical("No touchscreens left to watch");
+            return EXIT_FAILURE;
+        }
+
+        fds[0].fd = signalFds[0];
+        fds[0].events = POLLIN;
+        fds[1].fd = _socket;
+        fds[1].events = POLLIN;
+        for (int i = 0; i < _devices.length(); i++) {
+            fds[i + 2].fd = _devices[i]->touchScreen.fd();
+            fds[i + 2].events = POLLIN;
+        }
+
+        if (::poll(fds, _devices.length() + 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            qCritical("Drift daemon poll failed");
+            return EXIT_FAILURE;
+        }
+        if (fds[0].revents) {
+            break;
+        }
+
+        // Read the touches before the targets, so a target that arrives in the
+        // same wakeup as the end of its tap still finds it
+        for (int i = _devices.length() - 1; i >= 0; i--) {
+            if (fds[i + 2].revents && !readDevice(_devices[i])) {
+                qDebug("Touchscreen at %s disappeared", _devices[i]->touchScreen.path().toUtf8().constData());
+                delete _devices[i]->session;
+                delete _devices[i];
+                _devices.removeAt(i);
+            }
+        }
+        if (fds[1].revents) {
+            readMessages();
+        }
+    }
+
+    for (DriftDevice const *device : _devices) {
+        qDebug("%s: %lu drift updates, %lu taps rejected", device->touchScreen.path().toUtf8().constData(),
+               device->updates, device->rejected);
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Finds the touchscreens and the saved calibration for each one
+ * @return True if at least one touchscreen has a calibration to refine
+ */
+bool DriftDaemon::openDevices()
+{
+    // Records know which touchscreen they're for; the config file only knows the node
+    QVector<CalibrationRecord> records;
+    QList<DeviceCalibration> calibrations;
+    if (!CalibrationUtils::loadCalibrationRecords(records) &&
+        !CalibrationUtils::loadSavedCalibration(calibrations)) {
+        qCritical("There's no saved calibration to correct; calibrate first");
+        return false;
+    }
+
+    // Keep all of it, so that saving a correction for one touchscreen doesn't lose
+    // the others. The config file's sections are in the same order as the records,
+    // so it says which node each record's touchscreen was on.
+    if (records.isEmpty()) {
+        _saved = calibrations;
+    } else {
+        CalibrationUtils::loadSavedCalibration(calibrations);
+        for (int i = 0; i < records.length(); i++) {
+            CalibrationRecord const &record = records[i];
+            DeviceCalibration calibration;
+            calibration.identity.id.bustype = record.busType;
+            calibration.identity.id.vendor = record.vendor;
+            calibration.identity.id.product = record.product;
+            calibration.identity.id.version = record.deviceVersion;
+            memcpy(calibration.identity.phys, record.phys, sizeof(calibration.identity.phys));
+            memcpy(calibration.identity.uniq, record.uniq, sizeof(calibration.identity.uniq));
+            if (calibrations.length() == records.length()) {
+                calibration.path = calibrations[i].path;
+            }
+            calibration.axes.x.minimum = record.xMinimum;
+            calibration.axes.x.maximum = record.xMaximum;
+            calibration.axes.y.minimum = record.yMinimum;
+            calibration.axes.y.maximum = record.yMaximum;
+            for (int j = 0; j < 9; j++) {
+                calibration.matrix.append(record.matrix[j]);
+            }
+            _saved.append(calibration);
+        }
+    }
+
+    QVector<int> fds;
+    QStringList paths;
+    if (!CalibrationUtils::findTouchScreens(false, fds, paths)) {
+        return false;
+    }
+
+    for (int i = 0; i < fds.length(); i++) {
+        if (_devices.length() >= MAX_CALIBRATION_RECORDS) {
+            ::close(fds[i]);
+            continue;
+        }
+        DriftDevice *device = new DriftDevice(fds[i], paths[i]);
+
+        // Records go by identity; without them, the config file goes by node
+        device->saved = CalibrationRecordFile::find(records, device->touchScreen.identity());
+        for (int j = 0; records.isEmpty() && device->saved < 0 && j < _saved.length(); j++) {
+            if (_saved[j].path.isEmpty() || _saved[j].path == paths[i]) {
+                device->saved = j;
+            }
+        }
+        if (device->saved < 0) {
+            qCritical("No saved calibration for touchscreen %s", paths[i].toUtf8().constData());
+            delete device;
+            continue;
+        }
+        memcpy(device->applied, _saved[device->saved].matrix.constData(), sizeof(device->applied));
+
+        // With just one touchscreen, whichever one X has is it
+        device->sessionPath = fds.length() > 1 ? paths[i] : QString();
+        device->session = new CalibrationSession(device->sessionPath);
+        device->estimator.reset(device->applied, DRIFT_FORGETTING_FACTOR, DRIFT_INITIAL_COVARIANCE);
+        _devices.append(device);
+    }
+    if (_devices.isEmpty()) {
+        return false;
+    }
+
+    _screenSize = _devices[0]->session->screenSize();
+    if (_screenSize.isEmpty()) {
+        qCritical("Unable to find the screen size from X");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Creates the socket that clients send targets to
+ * @return True on success, false on failure
+ */
+bool DriftDaemon::openSocket()
+{
+    QByteArray const path = _socketPath.toUtf8();
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (static_cast<size_t>(path.length()) >= sizeof(address.sun_path)) {
+        qCritical("Drift socket path is too long");
+        return false;
+    }
+    memcpy(address.sun_path, path.constData(), path.length());
+
+    _socket = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_socket < 0) {
+        qCritical("Unable to create drift socket");
+        return false;
+    }
+
+    // A socket left behind by an earlier run would make bind() fail
+    ::unlink(path.constData());
+    if (::bind(_socket, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) < 0) {
+        qCritical("Unable to bind drift socket %s", path.constData());
+        ::close(_socket);
+        _socket = -1;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads whatever a touchscreen has for us
+ * @param device The touchscreen
+ * @return False if the touchscreen has gone away
+ */
+bool DriftDaemon::readDevice(DriftDevice *device)
+{
+    EventReader &reader = device->touchScreen.eventReader();
+    TouchDecoder &decoder = device->touchScreen.decoder();
+    reader.beginWakeup();
+    int count;
+    while ((count = reader.readBatch(device->touchScreen.fd())) > 0) {
+        input_event const *events = reader.events();
+        for (int i = 0; i < count; i++) {
+            if (decoder.processEvent(events[i])) {
+                handleSample(device, decoder.sample());
+            }
+        }
+        if (count < EVENT_BATCH_SIZE) {
+            break;
+        }
+    }
+    int const error = errno;
+    reader.endWakeup();
+    return !(count < 0 && error == ENODEV);
+}
+
+/**
+ * @brief Follows a touchscreen's taps, remembering where the last one landed
+ * @param device The touchscreen
+ * @param sample The decoded touch state
+ *
+ * The samples used are picked the same way as when calibrating, and a touch
+ * that moved around too much doesn't count, since it was a drag and not a tap.
+ */
+void DriftDaemon::handleSample(DriftDevice *device, TouchSample const &sample)
+{
+    TouchScreenDevice &touchScreen = device->touchScreen;
+    bool const justPressed = sample.pressed && !touchScreen.isPressed();
+    bool const justReleased = !sample.pressed && touchScreen.isPressed();
+    touchScreen.setPressed(sample.pressed);
+
+    // Part of this touch is missing, so it can't be trusted
+    if (sample.resynced) {
+        device->tap.reset();
+        device->tapFrames = 0;
+        device->haveTap = false;
+        return;
+    }
+
+    if (justPressed) {
+        device->tap.reset();
+        device->tapFrames = 0;
+        device->haveTap = false;
+    }
+    if (sample.pressed) {
+        device->tapFrames++;
+        if (device->tapFrames > _gate.settleFrames &&
+            (sample.pressure < 0 || sample.pressure >= _gate.minPressure)) {
+            device->tap.add(sample.xy);
+        }
+        return;
+    }
+
+    TouchAxes const &axes = touchScreen.axes();
+    if (justReleased && device->tap.count() > 0 &&
+        device->tap.isStable(DRIFT_MAX_TAP_STDDEV_FRACTION * axes.x.span(),
+                             DRIFT_MAX_TAP_STDDEV_FRACTION * axes.y.span())) {
+        device->haveTap = true;
+        device->tapPoint = device->tap.result();
+        device->tapTime = sample.time;
+    }
+}
+
+/**
+ * @brief Reads every target that clients have sent since last time
+ */
+void DriftDaemon::readMessages()
+{
+    char message[DRIFT_MESSAGE_SIZE];
+    ssize_t length;
+    while ((length = ::recv(_socket, message, sizeof(message) - 1, 0)) >= 0) {
+        message[length] = 0;
+        int x, y;
+        if (sscanf(message, "target %d %d", &x, &y) == 2) {
+            handleTarget(QPoint(x, y));
+        } else {
+            qDebug("Ignoring unknown drift message");
+        }
+    }
+}
+
+/**
+ * @brief Pairs a target from a client with the tap that was aimed at it, and learns from it
+ * @param target The center of what was tapped, in screen pixels
+ */
+void DriftDaemon::handleTarget(QPoint const &target)
+{
+    // The most recent tap on any touchscreen is the one the client saw
+    DriftDevice *device = nullptr;
+    for (DriftDevice *candidate : _devices) {
+        if (candidate->haveTap && (!device || timercmp(&candidate->tapTime, &device->tapTime, >))) {
+            device = candidate;
+        }
+    }
+    if (!device) {
+        return;
+    }
+    for (DriftDevice *other : _devices) {
+        other->haveTap = false;
+    }
+
+    // The kernel's timestamps are on the touchscreen's clock, so compare against that
+    timespec now;
+    clock_gettime(device->touchScreen.clock(), &now);
+    long long const ageMs = (static_cast<long long>(now.tv_sec) - device->tapTime.tv_sec) * 1000 +
+                            (now.tv_nsec / 1000 - device->tapTime.tv_usec) / 1000;
+    if (ageMs > DRIFT_PAIR_WINDOW_MS) {
+        device->rejected++;
+        return;
+    }
+
+    float current[9];
+    device->estimator.matrix(current);
+    TouchAxes const &axes = device->touchScreen.axes();
+    QPointF const landed = CalibrationMath::mapToScreen(current, device->tapPoint, axes, _screenSize);
+    QPointF const delta = landed - QPointF(target);
+    if (std::sqrt(delta.x() * delta.x() + delta.y() * delta.y()) > DRIFT_MAX_TARGET_DISTANCE) {
+        device->rejected++;
+        return;
+    }
+
+    device->estimator.update(axes.x.normalize(device->tapPoint.x()), axes.y.normalize(device->tapPoint.y()),
+                             static_cast<double>(target.x()) / _screenSize.width(),
+                             static_cast<double>(target.y()) / _screenSize.height());
+    device->updates++;
+    applyIfDrifted(device);
+}
+
+/**
+ * @brief Pushes a touchscreen's estimate to X and saves it, if it's moved far enough to matter
+ * @param device The touchscreen
+ */
+void DriftDaemon::applyIfDrifted(DriftDevice *device)
+{
+    if (device->estimator.samples() < DRIFT_MIN_SAMPLES) {
+        return;
+    }
+
+    float estimate[9];
+    device->estimator.matrix(estimate);
+    float const displacement = maxDisplacement(device->applied, estimate, _screenSize);
+    if (displacement < _threshold) {
+        return;
+    }
+
+    if (!device->session->apply(estimate)) {
+        qCritical("Unable to apply drift correction");
+        return;
+    }
+    memcpy(device->applied, estimate, sizeof(device->applied));
+    qDebug("Drift correction applied to %s, moving touches by up to %.1f pixels",
+           device->touchScreen.path().toUtf8().constData(), static_cast<double>(displacement));
+    saveCalibration();
+}
+
+/**
+ * @brief Saves what X currently has for every touchscreen
+ *
+ * Touchscreens that aren't being watched (or have gone away) keep what was
+ * saved for them before.
+ */
+void DriftDaemon::saveCalibration()
+{
+    QVector<bool> replaced(_saved.length(), false);
+    for (DriftDevice *device : _devices) {
+        DeviceCalibration calibration;
+        calibration.identity = device->touchScreen.identity();
+        calibration.path = device->touchScreen.path();
+        calibration.axes = device->touchScreen.axes();
+        for (int i = 0; i < 9; i++) {
+            calibration.matrix.append(device->applied[i]);
+        }
+
+        // A record without a unique ID can be shared by several panels of the same
+        // kind, but each one gets its own entry from now on
+        if (!replaced[device->saved]) {
+            _saved[device->saved] = calibration;
+            replaced[device->saved] = true;
+        } else if (_saved.length() < MAX_CALIBRATION_RECORDS) {
+            device->saved = _saved.length();
+            _saved.append(calibration);
+            replaced.append(true);
+        }
+    }
+    if (!CalibrationUtils::saveNewCalibration(_saved)) {
+        qCritical("Unable to save drift correction");
+    }
+}
+
+/**
+ * @brief Figures out how far apart two calibrations put the same touch, at worst
+ * @param a One 3x3 libinput calibration matrix
+ * @param b The other one
+ * @param screenSize The size of the screen in pixels
+ * @return The largest distance in pixels
+ *
+ * The difference between two affine transforms is affine too, so the worst
+ * case over the whole touchscreen is at one of its corners.
+ */
+float DriftDaemon::maxDisplacement(float const a[9], float const b[9], QSize const &screenSize)
+{
+    float worst = 0.0f;
+    for (int corner = 0; corner < 4; corner++) {
+        float const nx = (corner & 1) ? 1.0f : 0.0f;
+        float const ny = (corner & 2) ? 1.0f : 0.0f;
+        float const dx = ((a[0] - b[0]) * nx + (a[1] - b[1]) * ny + (a[2] - b[2])) * screenSize.width();
+        float const dy = ((a[3] - b[3]) * nx + (a[4] - b[4]) * ny + (a[5] - b[5])) * screenSize.height();
+        worst = qMax(worst, std::sqrt(dx * dx + dy * dy));
+    }
+    return worst;
+}
+
+/**
+ * @brief Arranges for SIGINT and SIGTERM to stop the daemon
+ * @return True on success, false on failure
+ *
+ * A flag checked before poll() would miss a signal that lands just before
+ * it, leaving the daemon asleep until the next touch. Instead the handler
+ * writes to a socket that poll() is watching, so it wakes up either way.
+ */
+bool DriftDaemon::setupSignals()
+{
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0, signalFds) < 0) {
+        qCritical("Unable to create signal socket");
+        return false;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = signalHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGINT, &action, nullptr) < 0 || sigaction(SIGTERM, &action, nullptr) < 0) {
+        qCritical("Unable to install quit signal handlers");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Signal handler that wakes up the poll loop to stop the daemon
+ * @param signum The signal that arrived
+ */
+void DriftDaemon::signalHandler(int signum)
+{
+    char const value = static_cast<char>(signum);
+    ssize_t result = ::write(signalFds[1], &value, sizeof(value));
+    Q_UNUSED(result);
+}
@@ -0,0 +1,84 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DRIFTDAEMON_H
+#define DRIFTDAEMON_H
+
+#include <QList>
+#include <QPoint>
+#include <QSize>
+#include <QString>
+#include <QVector>
+#include "calibrationutils.h"
+#include "calibrator.h"
+
+/// Where clients send the targets they saw tapped, unless told otherwise
+#define DRIFT_SOCKET_PATH               "/run/chumby8tscal.sock"
+
+struct DriftDevice;
+
+/**
+ * @brief Background mode that keeps the calibration up to date as the panel drifts
+ *
+ * Runs at low priority alongside the normal UI, reading the touchscreens
+ * without grabbing them. Whenever a client (the UI) sees a tap land on one of
+ * its buttons, it sends the button's center to a Unix datagram socket as
+ * "target <x> <y>" in screen pixels. The daemon pairs that with the tap that
+ * just ended, and uses it to refine that touchscreen's matrix with a
+ * DriftEstimator. The new matrix is only pushed to X (and saved) once it
+ * would move a touch somewhere on the screen by at least the threshold, so
+ * X and the flash aren't bothered for changes nobody could see.
+ *
+ * This doesn't need Qt's event loop; it's a plain poll() loop, like
+ * InputThread. Touchscreens that go away aren't waited for; the daemon exits
+ * once they're all gone so that whatever started it can start it again.
+ */
+class DriftDaemon
+{
+public:
+    DriftDaemon(QString const &socketPath, float threshold, PressureGate const &gate);
+    ~DriftDaemon();
+
+    int run();
+
+private:
+    Q_DISABLE_COPY(DriftDaemon)
+
+    bool openDevices();
+    bool openSocket();
+    bool readDevice(DriftDevice *device);
+    void handleSample(DriftDevice *device, TouchSample const &sample);
+    void readMessages();
+    void handleTarget(QPoint const &target);
+    void applyIfDrifted(DriftDevice *device);
+    void saveCalibration();
+    static float maxDisplacement(float const a[9], float const b[9], QSize const &screenSize);
+    bool setupSignals();
+    static void signalHandler(int signum);
+
+    QString _socketPath;
+    float _threshold;
+    PressureGate _gate;
+    int _socket;
+    QSize _screenSize;
+    QVector<DriftDevice *> _devices;
+    /// What was saved for every touchscreen, including ones that aren't being watched
+    QList<DeviceCalibration> _saved;
+};
+
+#endif // DRIFTDAEMON_H
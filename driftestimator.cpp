@@ -0,0 +1,117 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "driftestimator.h"
+
+/**
+ * @brief Constructor for DriftEstimator; starts out as the identity matrix
+ */
+DriftEstimator::DriftEstimator()
+{
+    float const identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    reset(identity, 1.0, 0.0);
+}
+
+/**
+ * @brief Starts over from a known calibration
+ * @param matrix The 3x3 libinput calibration matrix to start from (row by row)
+ * @param forgetting How much each new touch discounts the older ones (1 never forgets)
+ * @param covariance How far off the starting matrix might be; larger values let the first touches move it more
+ */
+void DriftEstimator::reset(float const matrix[9], double forgetting, double covariance)
+{
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            _p[r][c] = r == c ? covariance : 0.0;
+        }
+        _rowX[r] = matrix[r];
+        _rowY[r] = matrix[3 + r];
+    }
+    _forgetting = forgetting;
+    // Forgetting inflates the covariance in any direction the touches don't
+    // exercise (say, a UI with every button along the bottom), which would
+    // eventually make the matrix jump. Never let it grow past where it started.
+    _maxTrace = 3.0 * covariance;
+    _samples = 0;
+}
+
+/**
+ * @brief Folds in one touch
+ * @param rawX The touch's raw X, normalized to 0...1 with the touchscreen's axis range
+ * @param rawY The touch's raw Y, normalized the same way
+ * @param screenX Where it was aimed, as a fraction of the screen width
+ * @param screenY Where it was aimed, as a fraction of the screen height
+ */
+void DriftEstimator::update(double rawX, double rawY, double screenX, double screenY)
+{
+    double const row[3] = {rawX, rawY, 1.0};
+
+    // Gain vector k = P*row / (forgetting + row'*P*row)
+    double pRow[3];
+    double denominator = _forgetting;
+    for (int r = 0; r < 3; r++) {
+        pRow[r] = _p[r][0] * row[0] + _p[r][1] * row[1] + _p[r][2] * row[2];
+        denominator += row[r] * pRow[r];
+    }
+    double gain[3];
+    for (int r = 0; r < 3; r++) {
+        gain[r] = pRow[r] / denominator;
+    }
+
+    // Move both rows of the matrix by their prediction errors
+    double const errorX = screenX - (_rowX[0] * row[0] + _rowX[1] * row[1] + _rowX[2]);
+    double const errorY = screenY - (_rowY[0] * row[0] + _rowY[1] * row[1] + _rowY[2]);
+    for (int r = 0; r < 3; r++) {
+        _rowX[r] += gain[r] * errorX;
+        _rowY[r] += gain[r] * errorY;
+    }
+
+    // P = (P - k*row'*P) / forgetting. P is symmetric, so row'*P is just pRow.
+    double trace = 0.0;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            _p[r][c] = (_p[r][c] - gain[r] * pRow[c]) / _forgetting;
+        }
+        trace += _p[r][r];
+    }
+    if (trace > _maxTrace && trace > 0.0) {
+        double const scale = _maxTrace / trace;
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++) {
+                _p[r][c] *= scale;
+            }
+        }
+    }
+
+    _samples++;
+}
+
+/**
+ * @brief Gets the current estimate
+ * @param matrix Filled in with the 3x3 libinput calibration matrix (row by row)
+ */
+void DriftEstimator::matrix(float matrix[9]) const
+{
+    for (int i = 0; i < 3; i++) {
+        matrix[i] = static_cast<float>(_rowX[i]);
+        matrix[3 + i] = static_cast<float>(_rowY[i]);
+    }
+    matrix[6] = 0.0f;
+    matrix[7] = 0.0f;
+    matrix[8] = 1.0f;
+}
@@ -0,0 +1,52 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DRIFTESTIMATOR_H
+#define DRIFTESTIMATOR_H
+
+/**
+ * @brief Keeps refining an affine calibration matrix one touch at a time, by
+ *        recursive least squares
+ *
+ * Each update takes a raw touch that's known to have been aimed at a particular
+ * screen location, in the same normalized units as CalibrationMath::solveAffine(),
+ * and nudges the matrix toward it. Both rows of the matrix share one 3x3
+ * covariance, so an update is a fixed handful of multiplies and nothing is
+ * stored per sample. A forgetting factor below 1 lets old touches fade out, so
+ * the matrix follows the panel as it drifts.
+ */
+class DriftEstimator
+{
+public:
+    DriftEstimator();
+
+    void reset(float const matrix[9], double forgetting, double covariance);
+    void update(double rawX, double rawY, double screenX, double screenY);
+    void matrix(float matrix[9]) const;
+    unsigned long samples() const { return _samples; }
+
+private:
+    double _p[3][3];
+    double _rowX[3];
+    double _rowY[3];
+    double _forgetting;
+    double _maxTrace;
+    unsigned long _samples;
+};
+
+#endif // DRIFTESTIMATOR_H
@@ -0,0 +1,125 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "eventreader.h"
+#include <QtGlobal>
+#include <errno.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructor for EventReader
+ */
+EventReader::EventReader() :
+    _clock(CLOCK_REALTIME),
+    _wakeupEvents(0),
+    _wakeupReads(0),
+    _totalWakeups(0),
+    _totalEvents(0),
+    _totalReads(0),
+    _fullBatches(0),
+    _maxWakeupEvents(0)
+{
+    _readTime.tv_sec = 0;
+    _readTime.tv_usec = 0;
+    for (int i = 0; i < EVENT_HISTOGRAM_BUCKETS; i++) {
+        _histogram[i] = 0;
+    }
+}
+
+/**
+ * @brief Reads the next batch of events from a file descriptor
+ * @param fd The (non-blocking) evdev file descriptor to read from
+ * @return The number of events now available through events() (read at readTime()),
+ *         0 if nothing was available, or -1 on a read error (errno is preserved)
+ */
+int EventReader::readBatch(int fd)
+{
+    ssize_t result = ::read(fd, _events, sizeof(_events));
+    if (result < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+
+    // evdev only ever hands out whole events, so any remainder would be a bug
+    int count = static_cast<int>(result / static_cast<ssize_t>(sizeof(input_event)));
+    timespec now;
+    clock_gettime(_clock, &now);
+    _readTime.tv_sec = now.tv_sec;
+    _readTime.tv_usec = now.tv_nsec / 1000;
+    _wakeupReads++;
+    _wakeupEvents += count;
+    if (count == EVENT_BATCH_SIZE) {
+        _fullBatches++;
+    }
+    return count;
+}
+
+/**
+ * @brief Marks the start of a wakeup (one notification that the fd is readable)
+ */
+void EventReader::beginWakeup()
+{
+    _wakeupEvents = 0;
+    _wakeupReads = 0;
+}
+
+/**
+ * @brief Marks the end of a wakeup and folds it into the statistics
+ */
+void EventReader::endWakeup()
+{
+    _totalWakeups++;
+    _totalEvents += static_cast<unsigned long>(_wakeupEvents);
+    _totalReads += static_cast<unsigned long>(_wakeupReads);
+    if (_wakeupEvents > _maxWakeupEvents) {
+        _maxWakeupEvents = _wakeupEvents;
+    }
+
+    // Bucket 0 holds empty wakeups, bucket N holds 2^(N-1) to 2^N - 1 events
+    int bucket = 0;
+    for (int n = _wakeupEvents; n > 0 && bucket < EVENT_HISTOGRAM_BUCKETS - 1; n >>= 1) {
+        bucket++;
+    }
+    _histogram[bucket]++;
+}
+
+/**
+ * @brief Prints a summary of how many events arrived per wakeup
+ */
+void EventReader::logStatistics() const
+{
+    if (_totalWakeups == 0) {
+        return;
+    }
+
+    qDebug("Touchscreen input: %lu wakeups, %lu events, %lu reads (%lu full batches of %d)",
+           _totalWakeups, _totalEvents, _totalReads, _fullBatches, EVENT_BATCH_SIZE);
+    qDebug("Events per wakeup: average %.1f, maximum %d",
+           static_cast<double>(_totalEvents) / static_cast<double>(_totalWakeups), _maxWakeupEvents);
+    for (int i = 0; i < EVENT_HISTOGRAM_BUCKETS; i++) {
+        if (_histogram[i] == 0) {
+            continue;
+        }
+        int low = i == 0 ? 0 : (1 << (i - 1));
+        int high = i == 0 ? 0 : (1 << i) - 1;
+        if (i == EVENT_HISTOGRAM_BUCKETS - 1) {
+            qDebug("  %5d+      events: %lu", low, _histogram[i]);
+        } else {
+            qDebug("  %5d-%-5d events: %lu", low, high, _histogram[i]);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EVENTREADER_H
+#define EVENTREADER_H
+
+#include <linux/input.h>
+#include <time.h>
+
+/// Maximum number of input events pulled from the kernel with a single read()
+#define EVENT_BATCH_SIZE                64
+/// Number of buckets in the events-per-wakeup histogram (powers of two)
+#define EVENT_HISTOGRAM_BUCKETS         12
+
+/**
+ * @brief Reads raw evdev events in batches into a preallocated buffer
+ *
+ * A single touch frame is usually four or more events, so reading them one at
+ * a time costs a syscall per event. This pulls up to EVENT_BATCH_SIZE events
+ * per read() instead, and keeps track of how many arrive per wakeup so the
+ * batch size can be tuned. Each batch is timestamped when it's read, on the
+ * same clock as the kernel's event timestamps (see setClock()).
+ */
+class EventReader
+{
+public:
+    EventReader();
+
+    int readBatch(int fd);
+    input_event const *events() const { return _events; }
+    timeval const &readTime() const { return _readTime; }
+    void setClock(clockid_t clock) { _clock = clock; }
+
+    void beginWakeup();
+    void endWakeup();
+    unsigned long totalWakeups() const { return _totalWakeups; }
+    unsigned long totalEvents() const { return _totalEvents; }
+    void logStatistics() const;
+
+private:
+    input_event _events[EVENT_BATCH_SIZE];
+    clockid_t _clock;
+    timeval _readTime;
+
+    int _wakeupEvents;
+    int _wakeupReads;
+    unsigned long _totalWakeups;
+    unsigned long _totalEvents;
+    unsigned long _totalReads;
+    unsigned long _fullBatches;
+    int _maxWakeupEvents;
+    unsigned long _histogram[EVENT_HISTOGRAM_BUCKETS];
+};
+
+#endif // EVENTREADER_H
@@ -0,0 +1,1762 @@
+/* Generated by tools/rasterizeglyphs.cpp from /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf at 20 pixels. Do not edit.
+ * The glyph shapes are from the DejaVu fonts; see https://dejavu-fonts.github.io/License.html */
+
+#ifndef GLYPHDATA_H
+#define GLYPHDATA_H
+
+/// First character in the glyph set
+#define GLYPH_FIRST                     32
+/// Number of characters in the glyph set
+#define GLYPH_COUNT                     95
+/// Height of every glyph cell in pixels
+#define GLYPH_HEIGHT                    24
+
+/// Width of each glyph cell in pixels (its advance)
+static unsigned char const glyphWidths[GLYPH_COUNT] = {
+    6, 8, 9, 17, 13, 19, 16, 6, 8, 8, 10, 17, 6, 7, 6, 7,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 7, 17, 17, 17, 11,
+    20, 14, 14, 14, 15, 13, 12, 16, 15, 6, 6, 13, 11, 17, 15, 16,
+    12, 16, 14, 13, 12, 15, 14, 20, 14, 12, 14, 8, 7, 8, 17, 10,
+    10, 12, 13, 11, 13, 12, 7, 13, 13, 6, 6, 12, 6, 19, 13, 12,
+    13, 13, 8, 10, 8, 13, 12, 16, 12, 12, 11, 13, 7, 13, 17
+};
+
+/// Where each glyph's cell starts in glyphAlpha
+static unsigned short const glyphOffsets[GLYPH_COUNT] = {
+    0, 144, 336, 552, 960, 1272, 1728, 2112, 2256, 2448, 2640, 2880,
+    3288, 3432, 3600, 3744, 3912, 4224, 4536, 4848, 5160, 5472, 5784, 6096,
+    6408, 6720, 7032, 7200, 7368, 7776, 8184, 8592, 8856, 9336, 9672, 10008,
+    10344, 10704, 11016, 11304, 11688, 12048, 12192, 12336, 12648, 12912, 13320, 13680,
+    14064, 14352, 14736, 15072, 15384, 15672, 16032, 16368, 16848, 17184, 17472, 17808,
+    18000, 18168, 18360, 18768, 19008, 19248, 19536, 19848, 20112, 20424, 20712, 20880,
+    21192, 21504, 21648, 21792, 22080, 22224, 22680, 22992, 23280, 23592, 23904, 24096,
+    24336, 24528, 24840, 25128, 25512, 25800, 26088, 26352, 26664, 26832, 27144
+};
+
+/// Coverage of every pixel of every cell, row by row (0 is clear, 255 is solid)
+static unsigned char const glyphAlpha[27552] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,252,255,0,0,0,0,0,0,252,255,0,0,0,
+    0,0,0,252,255,0,0,0,0,0,0,252,255,0,0,0,
+    0,0,0,252,255,0,0,0,0,0,0,252,255,0,0,0,
+    0,0,0,252,255,0,0,0,0,0,0,247,251,0,0,0,
+    0,0,0,234,238,0,0,0,0,0,0,220,226,0,0,0,
+    0,0,0,207,214,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,252,255,0,0,0,
+    0,0,0,252,255,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,20,255,148,0,100,255,72,0,0,20,255,
+    148,0,100,255,72,0,0,20,255,148,0,100,255,72,0,0,
+    20,255,148,0,100,255,72,0,0,20,255,148,0,100,255,72,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,3,240,162,0,0,130,253,17,0,0,0,0,0,0,
+    0,0,0,51,255,97,0,0,196,205,0,0,0,0,0,0,
+    0,0,0,0,114,255,32,0,11,250,140,0,0,0,0,0,
+    0,0,0,0,0,177,224,0,0,71,255,76,0,0,0,0,
+    0,0,88,255,255,255,255,255,255,255,255,255,255,255,255,56,
+    0,0,0,88,255,255,255,255,255,255,255,255,255,255,255,255,
+    56,0,0,0,0,0,0,87,255,64,0,1,233,169,0,0,
+    0,0,0,0,0,0,0,0,156,243,6,0,47,255,101,0,
+    0,0,0,0,0,0,0,0,0,225,179,0,0,114,255,33,
+    0,0,0,0,0,0,116,255,255,255,255,255,255,255,255,255,
+    255,255,255,28,0,0,0,116,255,255,255,255,255,255,255,255,
+    255,255,255,255,28,0,0,0,0,0,0,129,253,17,0,21,
+    254,122,0,0,0,0,0,0,0,0,0,0,194,205,0,0,
+    86,255,57,0,0,0,0,0,0,0,0,0,9,249,140,0,
+    0,151,244,5,0,0,0,0,0,0,0,0,0,68,255,76,
+    0,0,216,184,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,56,196,0,0,0,0,0,
+    0,0,0,0,0,0,56,196,0,0,0,0,0,0,0,0,
+    1,93,192,240,255,228,173,72,1,0,0,0,0,161,255,255,
+    255,255,255,255,255,44,0,0,0,41,255,243,91,69,197,33,
+    84,184,42,0,0,0,80,255,138,0,56,196,0,0,0,0,
+    0,0,0,47,255,161,0,56,196,0,0,0,0,0,0,0,
+    1,181,255,168,130,202,4,0,0,0,0,0,0,0,10,132,
+    230,255,255,246,181,67,0,0,0,0,0,0,0,1,80,220,
+    140,231,255,103,0,0,0,0,0,0,0,56,196,0,18,234,
+    235,0,0,0,0,0,0,0,56,196,0,0,210,255,9,0,
+    0,81,170,71,12,56,197,38,147,255,224,0,0,0,88,255,
+    255,255,248,255,255,255,253,85,0,0,0,5,77,166,214,246,
+    253,218,163,45,0,0,0,0,0,0,0,0,60,196,0,0,
+    0,0,0,0,0,0,0,0,0,58,196,0,0,0,0,0,
+    0,0,0,0,0,0,57,196,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,86,217,249,212,76,0,0,0,0,0,
+    22,239,137,0,0,0,0,0,52,254,119,17,137,252,41,0,
+    0,0,0,162,226,11,0,0,0,0,0,168,224,1,0,6,
+    237,155,0,0,0,62,255,82,0,0,0,0,0,0,210,180,
+    0,0,0,197,198,0,0,4,212,182,0,0,0,0,0,0,
+    0,211,179,0,0,0,197,197,0,0,117,247,35,0,0,0,
+    0,0,0,0,169,222,0,0,5,236,156,0,28,243,127,0,
+    0,0,0,0,0,0,0,55,254,115,16,132,252,43,0,173,
+    219,7,0,0,0,0,0,0,0,0,0,88,218,250,213,79,
+    0,72,255,71,0,78,212,249,217,88,0,0,0,0,0,0,
+    0,0,0,7,219,172,0,44,252,133,17,118,254,56,0,0,
+    0,0,0,0,0,0,128,243,28,0,157,236,5,0,1,224,
+    172,0,0,0,0,0,0,0,35,247,116,0,0,198,196,0,
+    0,0,180,214,0,0,0,0,0,0,0,183,212,4,0,0,
+    199,195,0,0,0,181,213,0,0,0,0,0,0,83,255,62,
+    0,0,0,157,236,5,0,1,224,171,0,0,0,0,0,11,
+    226,161,0,0,0,0,44,253,133,16,118,254,55,0,0,0,
+    0,0,138,239,22,0,0,0,0,0,80,213,250,218,88,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,78,197,240,231,182,74,1,0,0,0,0,0,
+    0,0,0,108,255,255,255,255,255,255,36,0,0,0,0,0,
+    0,0,1,233,255,133,21,11,72,182,34,0,0,0,0,0,
+    0,0,11,255,218,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,227,238,13,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,110,255,181,6,0,0,0,0,0,0,0,0,0,
+    0,0,7,165,255,255,182,9,0,0,0,0,0,0,0,0,
+    0,0,165,253,87,150,255,195,15,0,0,0,149,255,51,0,
+    0,72,255,141,0,0,135,255,207,22,0,0,201,238,6,0,
+    0,158,255,52,0,0,0,119,255,218,31,40,254,144,0,0,
+    0,181,255,55,0,0,0,0,105,254,227,195,239,23,0,0,
+    0,146,255,161,0,0,0,0,0,93,255,255,114,0,0,0,
+    0,48,253,255,175,54,11,16,76,197,255,252,222,19,0,0,
+    0,0,106,252,255,255,255,255,255,252,112,120,255,190,4,0,
+    0,0,0,54,168,230,250,231,167,48,0,3,204,255,147,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,20,255,148,0,0,0,20,
+    255,148,0,0,0,20,255,148,0,0,0,20,255,148,0,0,
+    0,20,255,148,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,164,232,10,0,0,0,0,51,254,113,0,0,
+    0,0,0,183,239,9,0,0,0,0,35,254,154,0,0,0,
+    0,0,133,255,67,0,0,0,0,0,203,253,12,0,0,0,
+    0,11,251,212,0,0,0,0,0,41,255,186,0,0,0,0,
+    0,62,255,168,0,0,0,0,0,62,255,169,0,0,0,0,
+    0,41,255,187,0,0,0,0,0,11,252,215,0,0,0,0,
+    0,0,203,254,14,0,0,0,0,0,134,255,72,0,0,0,
+    0,0,36,254,159,0,0,0,0,0,0,185,242,10,0,0,
+    0,0,0,52,254,115,0,0,0,0,0,0,164,232,10,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,39,252,114,0,0,0,0,0,0,163,238,17,0,0,0,
+    0,0,44,255,131,0,0,0,0,0,0,207,230,4,0,0,
+    0,0,0,119,255,77,0,0,0,0,0,60,255,147,0,0,
+    0,0,0,9,252,209,0,0,0,0,0,0,235,243,0,0,
+    0,0,0,0,216,255,9,0,0,0,0,0,218,255,8,0,
+    0,0,0,0,236,243,0,0,0,0,0,10,253,209,0,0,
+    0,0,0,61,255,147,0,0,0,0,0,120,255,78,0,0,
+    0,0,0,208,231,4,0,0,0,0,44,255,132,0,0,0,
+    0,0,164,238,18,0,0,0,0,38,252,114,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,144,144,0,0,
+    0,0,0,0,0,0,144,144,0,0,0,0,36,192,43,0,
+    144,144,0,43,192,36,13,135,242,131,151,151,131,242,136,13,
+    0,0,31,168,253,254,170,32,0,0,0,0,30,167,253,254,
+    168,30,0,0,11,131,241,132,151,152,132,241,132,11,37,193,
+    44,0,144,144,0,44,193,37,0,0,0,0,144,144,0,0,
+    0,0,0,0,0,0,144,144,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,
+    52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,
+    255,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    112,255,52,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,112,255,52,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,112,255,52,0,0,0,0,0,0,0,0,0,224,255,
+    255,255,255,255,255,255,255,255,255,255,164,0,0,0,0,224,
+    255,255,255,255,255,255,255,255,255,255,255,164,0,0,0,0,
+    0,0,0,0,0,112,255,52,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,112,255,52,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,112,255,52,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,112,255,52,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,112,255,52,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    168,255,104,0,0,0,170,255,100,0,0,0,215,244,20,0,
+    0,22,255,137,0,0,0,85,245,21,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,255,
+    255,255,60,4,255,255,255,255,255,60,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,220,255,52,0,0,0,220,255,
+    52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    23,253,146,0,0,0,0,102,255,65,0,0,0,0,183,236,
+    3,0,0,0,15,249,159,0,0,0,0,90,255,77,0,0,
+    0,0,171,244,8,0,0,0,8,243,171,0,0,0,0,78,
+    255,90,0,0,0,0,159,249,15,0,0,0,3,236,183,0,
+    0,0,0,65,255,102,0,0,0,0,147,253,23,0,0,0,
+    0,227,195,0,0,0,0,53,255,114,0,0,0,0,134,255,
+    33,0,0,0,0,215,208,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,
+    158,231,248,216,123,5,0,0,0,0,0,30,231,255,255,255,
+    255,255,182,3,0,0,0,0,179,255,195,42,8,72,233,255,
+    102,0,0,0,31,255,243,19,0,0,0,79,255,209,0,0,
+    0,101,255,163,0,0,0,0,1,235,255,24,0,0,143,255,
+    111,0,0,0,0,0,184,255,66,0,0,165,255,85,0,0,
+    0,0,0,158,255,87,0,0,173,255,78,0,0,0,0,0,
+    151,255,96,0,0,165,255,85,0,0,0,0,0,158,255,87,
+    0,0,143,255,111,0,0,0,0,0,184,255,66,0,0,101,
+    255,163,0,0,0,0,1,234,255,24,0,0,31,255,242,19,
+    0,0,0,79,255,209,0,0,0,0,179,255,194,41,7,71,
+    233,255,102,0,0,0,0,31,232,255,255,255,255,255,183,3,
+    0,0,0,0,0,27,159,232,249,218,124,6,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,23,95,168,238,255,168,0,0,0,0,
+    0,0,0,204,255,255,255,255,168,0,0,0,0,0,0,0,
+    180,161,88,94,255,168,0,0,0,0,0,0,0,0,0,0,
+    76,255,168,0,0,0,0,0,0,0,0,0,0,76,255,168,
+    0,0,0,0,0,0,0,0,0,0,76,255,168,0,0,0,
+    0,0,0,0,0,0,0,76,255,168,0,0,0,0,0,0,
+    0,0,0,0,76,255,168,0,0,0,0,0,0,0,0,0,
+    0,76,255,168,0,0,0,0,0,0,0,0,0,0,76,255,
+    168,0,0,0,0,0,0,0,0,0,0,76,255,168,0,0,
+    0,0,0,0,0,0,0,0,76,255,168,0,0,0,0,0,
+    0,0,0,0,0,76,255,168,0,0,0,0,0,0,0,132,
+    255,255,255,255,255,255,255,224,0,0,0,0,132,255,255,255,
+    255,255,255,255,224,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,8,80,166,
+    215,246,240,194,94,1,0,0,0,0,112,255,255,255,255,255,
+    255,255,163,0,0,0,0,103,174,88,40,10,30,133,255,255,
+    76,0,0,0,0,0,0,0,0,0,0,157,255,147,0,0,
+    0,0,0,0,0,0,0,0,99,255,153,0,0,0,0,0,
+    0,0,0,0,0,145,255,97,0,0,0,0,0,0,0,0,
+    0,42,247,221,7,0,0,0,0,0,0,0,0,23,221,248,
+    55,0,0,0,0,0,0,0,0,21,211,250,78,0,0,0,
+    0,0,0,0,0,23,212,251,84,0,0,0,0,0,0,0,
+    0,27,216,252,86,0,0,0,0,0,0,0,0,32,221,252,
+    88,0,0,0,0,0,0,0,0,35,225,252,90,0,0,0,
+    0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,184,
+    0,0,0,136,255,255,255,255,255,255,255,255,184,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,48,140,206,241,246,212,132,15,0,0,
+    0,0,8,255,255,255,255,255,255,255,219,20,0,0,0,7,
+    199,104,46,11,20,81,227,255,140,0,0,0,0,0,0,0,
+    0,0,0,81,255,191,0,0,0,0,0,0,0,0,0,0,
+    76,255,168,0,0,0,0,0,0,0,0,16,72,220,252,60,
+    0,0,0,0,0,0,244,255,255,255,201,68,0,0,0,0,
+    0,0,0,244,255,255,255,234,122,1,0,0,0,0,0,0,
+    0,1,22,81,217,255,128,0,0,0,0,0,0,0,0,0,
+    0,31,254,242,1,0,0,0,0,0,0,0,0,0,0,230,
+    255,23,0,0,0,0,0,0,0,0,0,38,255,250,7,0,
+    0,107,151,61,26,7,29,95,224,255,173,0,0,0,120,255,
+    255,255,255,255,255,255,217,26,0,0,0,10,94,182,225,250,
+    239,198,117,10,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,69,255,255,132,0,0,0,0,0,0,0,0,7,218,
+    253,255,132,0,0,0,0,0,0,0,0,125,250,154,255,132,
+    0,0,0,0,0,0,0,33,246,136,112,255,132,0,0,0,
+    0,0,0,0,180,226,11,112,255,132,0,0,0,0,0,0,
+    80,255,81,0,112,255,132,0,0,0,0,0,10,224,181,0,
+    0,112,255,132,0,0,0,0,0,135,247,34,0,0,112,255,
+    132,0,0,0,0,40,249,125,0,0,0,112,255,132,0,0,
+    0,0,189,218,7,0,0,0,112,255,132,0,0,0,4,255,
+    255,255,255,255,255,255,255,255,255,156,0,4,255,255,255,255,
+    255,255,255,255,255,255,156,0,0,0,0,0,0,0,0,112,
+    255,132,0,0,0,0,0,0,0,0,0,0,112,255,132,0,
+    0,0,0,0,0,0,0,0,0,112,255,132,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,216,255,255,255,255,255,255,232,0,0,
+    0,0,0,216,255,255,255,255,255,255,232,0,0,0,0,0,
+    216,248,0,0,0,0,0,0,0,0,0,0,0,216,248,0,
+    0,0,0,0,0,0,0,0,0,0,216,248,0,0,0,0,
+    0,0,0,0,0,0,0,216,253,205,248,239,191,90,0,0,
+    0,0,0,0,216,255,255,255,255,255,255,161,1,0,0,0,
+    0,165,90,34,9,41,139,251,255,99,0,0,0,0,0,0,
+    0,0,0,0,119,255,199,0,0,0,0,0,0,0,0,0,
+    0,25,255,241,0,0,0,0,0,0,0,0,0,0,25,255,
+    240,0,0,0,0,0,0,0,0,0,0,117,255,200,0,0,
+    0,104,154,64,27,9,39,135,251,255,103,0,0,0,116,255,
+    255,255,255,255,255,255,165,2,0,0,0,10,93,183,226,250,
+    234,184,86,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    55,170,231,246,210,123,15,0,0,0,0,0,109,253,255,255,
+    255,255,255,132,0,0,0,0,68,255,255,152,39,6,34,129,
+    115,0,0,0,0,210,255,151,0,0,0,0,0,0,0,0,
+    0,51,255,249,19,0,0,0,0,0,0,0,0,0,109,255,
+    185,0,0,0,0,0,0,0,0,0,0,140,255,134,54,191,
+    245,239,186,70,0,0,0,0,152,255,158,247,255,255,255,255,
+    255,106,0,0,0,144,255,254,184,48,9,34,151,255,247,23,
+    0,0,122,255,235,10,0,0,0,0,195,255,92,0,0,79,
+    255,195,0,0,0,0,0,144,255,114,0,0,14,249,235,10,
+    0,0,0,0,195,255,89,0,0,0,152,255,183,47,9,34,
+    151,255,243,20,0,0,0,17,214,255,255,255,255,255,253,94,
+    0,0,0,0,0,15,140,223,250,236,178,59,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,92,255,255,255,255,255,255,255,255,255,3,
+    0,0,92,255,255,255,255,255,255,255,255,198,0,0,0,0,
+    0,0,0,0,0,0,142,255,102,0,0,0,0,0,0,0,
+    0,0,5,234,247,15,0,0,0,0,0,0,0,0,0,82,
+    255,166,0,0,0,0,0,0,0,0,0,0,180,255,70,0,
+    0,0,0,0,0,0,0,0,25,252,228,2,0,0,0,0,
+    0,0,0,0,0,120,255,135,0,0,0,0,0,0,0,0,
+    0,0,217,255,39,0,0,0,0,0,0,0,0,0,61,255,
+    199,0,0,0,0,0,0,0,0,0,0,159,255,103,0,0,
+    0,0,0,0,0,0,0,12,244,247,16,0,0,0,0,0,
+    0,0,0,0,99,255,167,0,0,0,0,0,0,0,0,0,
+    0,197,255,71,0,0,0,0,0,0,0,0,0,39,255,229,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,
+    186,227,246,217,160,38,0,0,0,0,0,134,255,255,255,255,
+    255,255,248,65,0,0,0,26,253,255,131,27,8,46,183,255,
+    206,0,0,0,68,255,196,0,0,0,0,16,253,251,0,0,
+    0,42,255,196,0,0,0,0,16,253,225,0,0,0,0,185,
+    255,131,27,7,45,183,255,113,0,0,0,0,10,142,242,255,
+    255,255,223,102,0,0,0,0,0,35,186,254,255,255,255,245,
+    151,9,0,0,0,16,232,254,125,30,9,46,174,255,177,0,
+    0,0,116,255,152,0,0,0,0,4,216,255,43,0,0,155,
+    255,100,0,0,0,0,0,168,255,83,0,0,141,255,151,0,
+    0,0,0,4,217,255,68,0,0,70,255,253,122,28,8,45,
+    174,255,241,12,0,0,0,167,255,255,255,255,255,255,254,96,
+    0,0,0,0,1,100,196,241,251,232,175,61,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,96,199,243,245,205,102,1,0,0,
+    0,0,0,159,255,255,255,255,255,255,155,0,0,0,0,76,
+    255,247,104,23,14,74,224,255,75,0,0,0,158,255,126,0,
+    0,0,0,63,255,185,0,0,0,182,255,75,0,0,0,0,
+    12,255,250,7,0,0,162,255,126,0,0,0,0,63,255,255,
+    45,0,0,86,255,247,104,22,13,74,223,254,255,66,0,0,
+    2,178,255,255,255,255,255,217,191,255,76,0,0,0,4,113,
+    207,247,239,164,22,207,255,63,0,0,0,0,0,0,0,0,
+    0,8,249,255,32,0,0,0,0,0,0,0,0,0,84,255,
+    230,0,0,0,0,0,0,0,0,0,9,211,255,135,0,0,
+    0,0,162,93,29,8,59,197,255,231,17,0,0,0,0,204,
+    255,255,255,255,255,238,52,0,0,0,0,0,38,155,223,248,
+    221,145,24,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,168,255,104,0,0,0,0,
+    168,255,104,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,168,255,104,0,0,0,0,168,255,104,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,168,255,104,0,0,0,0,168,255,104,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,168,255,104,0,0,0,0,
+    170,255,100,0,0,0,0,215,244,20,0,0,0,22,255,137,
+    0,0,0,0,85,245,21,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,51,146,144,0,0,
+    0,0,0,0,0,0,0,0,0,24,116,211,255,255,153,0,
+    0,0,0,0,0,0,0,7,85,180,252,255,241,157,63,1,
+    0,0,0,0,0,0,54,150,238,255,251,182,88,9,0,0,
+    0,0,0,0,0,109,214,255,255,207,113,23,0,0,0,0,
+    0,0,0,0,0,0,224,255,238,81,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,110,215,255,255,199,106,19,0,0,
+    0,0,0,0,0,0,0,0,0,0,55,151,238,255,250,176,
+    84,7,0,0,0,0,0,0,0,0,0,0,0,7,86,181,
+    252,255,239,154,61,1,0,0,0,0,0,0,0,0,0,0,
+    0,24,117,212,255,255,153,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,52,147,144,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,224,255,255,255,
+    255,255,255,255,255,255,255,255,164,0,0,0,0,224,255,255,
+    255,255,255,255,255,255,255,255,255,164,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    224,255,255,255,255,255,255,255,255,255,255,255,164,0,0,0,
+    0,224,255,255,255,255,255,255,255,255,255,255,255,164,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,187,124,30,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,213,255,254,189,93,11,0,0,0,0,0,0,0,0,
+    0,0,0,7,86,180,251,255,243,158,63,1,0,0,0,0,
+    0,0,0,0,0,0,0,22,112,206,255,255,221,127,33,0,
+    0,0,0,0,0,0,0,0,0,0,0,43,137,228,255,254,
+    192,73,0,0,0,0,0,0,0,0,0,0,0,0,3,129,
+    253,255,164,0,0,0,0,0,0,0,0,0,0,38,130,222,
+    255,254,193,73,0,0,0,0,0,0,0,20,107,200,255,255,
+    222,128,34,0,0,0,0,0,0,7,83,176,250,255,243,159,
+    64,1,0,0,0,0,0,0,0,0,213,255,254,190,94,11,
+    0,0,0,0,0,0,0,0,0,0,0,187,125,30,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,16,109,195,
+    231,249,212,103,0,0,0,0,144,255,255,255,255,255,255,128,
+    0,0,0,127,146,54,9,23,142,255,248,12,0,0,0,0,
+    0,0,0,0,220,255,48,0,0,0,0,0,0,0,2,233,
+    254,25,0,0,0,0,0,0,0,128,255,175,0,0,0,0,
+    0,0,0,105,255,221,21,0,0,0,0,0,0,67,252,235,
+    37,0,0,0,0,0,0,0,212,255,64,0,0,0,0,0,
+    0,0,16,255,211,0,0,0,0,0,0,0,0,31,255,193,
+    0,0,0,0,0,0,0,0,32,255,192,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,255,
+    204,0,0,0,0,0,0,0,0,48,255,204,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,46,138,207,237,247,222,179,94,10,0,0,0,0,0,
+    0,0,0,0,14,162,254,255,255,255,255,255,255,255,225,77,
+    0,0,0,0,0,0,0,28,214,255,226,125,54,14,6,27,
+    78,161,251,254,105,0,0,0,0,0,8,204,255,144,7,0,
+    0,0,0,0,0,0,38,210,254,77,0,0,0,0,126,255,
+    117,0,0,0,0,0,0,0,0,0,0,14,210,223,3,0,
+    0,12,241,181,0,0,0,88,210,249,219,96,60,255,40,0,
+    61,255,71,0,0,81,255,58,0,0,93,255,255,255,255,255,
+    157,255,40,0,0,233,130,0,0,139,229,0,0,0,224,247,
+    95,17,15,87,241,255,40,0,0,212,150,0,0,164,195,0,
+    0,22,255,141,0,0,0,0,125,255,40,0,2,244,132,0,
+    0,165,192,0,0,22,255,139,0,0,0,0,125,255,40,0,
+    103,255,72,0,0,141,226,0,0,0,224,245,91,16,14,82,
+    240,255,66,120,250,206,2,0,0,85,255,48,0,0,94,255,
+    255,255,255,255,157,255,255,255,217,31,0,0,0,15,245,175,
+    0,0,0,89,211,249,221,100,59,239,197,114,11,0,0,0,
+    0,0,137,255,106,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,13,214,253,127,3,0,0,0,0,0,
+    0,18,179,75,0,0,0,0,0,0,0,35,223,255,219,112,
+    44,13,9,45,127,237,246,66,0,0,0,0,0,0,0,0,
+    20,175,255,255,255,255,255,255,255,223,59,0,0,0,0,0,
+    0,0,0,0,0,0,56,148,213,242,243,204,116,13,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,120,255,255,35,0,0,0,0,0,0,0,
+    0,0,0,214,255,255,129,0,0,0,0,0,0,0,0,0,
+    53,255,194,248,223,1,0,0,0,0,0,0,0,0,148,255,
+    94,176,255,63,0,0,0,0,0,0,0,6,236,248,15,89,
+    255,158,0,0,0,0,0,0,0,82,255,175,0,12,246,242,
+    10,0,0,0,0,0,0,177,255,88,0,0,172,255,92,0,
+    0,0,0,0,21,250,245,11,0,0,85,255,187,0,0,0,
+    0,0,111,255,170,0,0,0,10,244,253,28,0,0,0,0,
+    206,255,83,0,0,0,0,167,255,121,0,0,0,45,255,255,
+    255,255,255,255,255,255,255,216,0,0,0,140,255,255,255,255,
+    255,255,255,255,255,255,55,0,3,231,255,86,0,0,0,0,
+    0,0,164,255,150,0,74,255,225,4,0,0,0,0,0,0,
+    50,255,238,7,169,255,116,0,0,0,0,0,0,0,0,193,
+    255,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,8,255,255,255,255,255,248,218,144,22,0,0,0,0,8,
+    255,255,255,255,255,255,255,255,225,21,0,0,0,8,255,240,
+    0,0,0,17,74,228,255,130,0,0,0,8,255,240,0,0,
+    0,0,0,99,255,172,0,0,0,8,255,240,0,0,0,0,
+    0,99,255,152,0,0,0,8,255,240,0,0,0,15,71,226,
+    255,66,0,0,0,8,255,255,255,255,255,255,255,212,86,0,
+    0,0,0,8,255,255,255,255,255,255,255,245,147,5,0,0,
+    0,8,255,240,0,0,0,11,52,184,255,159,0,0,0,8,
+    255,240,0,0,0,0,0,11,243,253,27,0,0,8,255,240,
+    0,0,0,0,0,0,211,255,68,0,0,8,255,240,0,0,
+    0,0,0,11,243,255,61,0,0,8,255,240,0,0,0,11,
+    51,183,255,239,9,0,0,8,255,255,255,255,255,255,255,255,
+    253,91,0,0,0,8,255,255,255,255,255,251,229,170,57,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,29,138,208,240,247,223,194,121,33,0,0,0,
+    0,97,248,255,255,255,255,255,255,255,224,0,0,0,87,255,
+    255,177,68,17,7,31,59,132,189,0,0,13,238,255,131,0,
+    0,0,0,0,0,0,0,0,0,105,255,209,1,0,0,0,
+    0,0,0,0,0,0,0,171,255,116,0,0,0,0,0,0,
+    0,0,0,0,0,206,255,69,0,0,0,0,0,0,0,0,
+    0,0,0,219,255,56,0,0,0,0,0,0,0,0,0,0,
+    0,206,255,69,0,0,0,0,0,0,0,0,0,0,0,171,
+    255,116,0,0,0,0,0,0,0,0,0,0,0,105,255,208,
+    1,0,0,0,0,0,0,0,0,0,0,13,239,255,127,0,
+    0,0,0,0,0,0,0,0,0,0,89,255,255,175,67,16,
+    6,30,58,131,189,0,0,0,0,101,249,255,255,255,255,255,
+    255,255,224,0,0,0,0,0,31,140,209,241,248,223,193,121,
+    33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,255,255,255,248,233,200,146,56,0,
+    0,0,0,0,8,255,255,255,255,255,255,255,255,255,178,19,
+    0,0,0,8,255,240,0,0,3,20,63,146,248,255,199,6,
+    0,0,8,255,240,0,0,0,0,0,0,52,243,255,106,0,
+    0,8,255,240,0,0,0,0,0,0,0,117,255,206,0,0,
+    8,255,240,0,0,0,0,0,0,0,26,255,253,13,0,8,
+    255,240,0,0,0,0,0,0,0,0,237,255,38,0,8,255,
+    240,0,0,0,0,0,0,0,0,224,255,51,0,8,255,240,
+    0,0,0,0,0,0,0,0,238,255,37,0,8,255,240,0,
+    0,0,0,0,0,0,26,255,252,12,0,8,255,240,0,0,
+    0,0,0,0,0,118,255,204,0,0,8,255,240,0,0,0,
+    0,0,0,52,243,255,103,0,0,8,255,240,0,0,3,19,
+    62,145,248,255,196,6,0,0,8,255,255,255,255,255,255,255,
+    255,255,176,18,0,0,0,8,255,255,255,255,249,234,201,146,
+    55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,255,255,255,255,255,255,255,255,48,
+    0,0,8,255,255,255,255,255,255,255,255,255,48,0,0,8,
+    255,240,0,0,0,0,0,0,0,0,0,0,8,255,240,0,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,
+    0,0,0,8,255,255,255,255,255,255,255,255,224,0,0,0,
+    8,255,255,255,255,255,255,255,255,224,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,
+    0,0,0,0,0,0,0,8,255,240,0,0,0,0,0,0,
+    0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,0,0,8,255,
+    255,255,255,255,255,255,255,255,92,0,0,8,255,255,255,255,
+    255,255,255,255,255,92,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,8,255,255,255,255,255,255,
+    255,255,88,0,0,8,255,255,255,255,255,255,255,255,88,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,
+    0,8,255,255,255,255,255,255,255,184,0,0,0,8,255,255,
+    255,255,255,255,255,184,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,27,134,203,237,
+    249,229,206,159,79,9,0,0,0,0,0,98,248,255,255,255,
+    255,255,255,255,255,124,0,0,0,0,91,255,255,180,73,21,
+    5,23,48,93,175,114,0,0,0,14,240,255,127,0,0,0,
+    0,0,0,0,0,0,0,0,0,107,255,206,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,172,255,114,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,207,255,69,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,220,255,56,0,0,0,0,
+    80,255,255,255,255,220,0,0,0,207,255,69,0,0,0,0,
+    80,255,255,255,255,220,0,0,0,173,255,114,0,0,0,0,
+    0,0,0,24,255,220,0,0,0,107,255,205,0,0,0,0,
+    0,0,0,24,255,220,0,0,0,15,241,255,124,0,0,0,
+    0,0,0,24,255,220,0,0,0,0,93,255,255,177,72,20,
+    4,19,51,138,255,219,0,0,0,0,0,102,249,255,255,255,
+    255,255,255,255,228,66,0,0,0,0,0,0,29,136,205,239,
+    251,233,185,105,8,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,228,
+    255,20,0,0,8,255,240,0,0,0,0,0,0,0,228,255,
+    20,0,0,8,255,240,0,0,0,0,0,0,0,228,255,20,
+    0,0,8,255,240,0,0,0,0,0,0,0,228,255,20,0,
+    0,8,255,240,0,0,0,0,0,0,0,228,255,20,0,0,
+    8,255,240,0,0,0,0,0,0,0,228,255,20,0,0,8,
+    255,255,255,255,255,255,255,255,255,255,255,20,0,0,8,255,
+    255,255,255,255,255,255,255,255,255,255,20,0,0,8,255,240,
+    0,0,0,0,0,0,0,228,255,20,0,0,8,255,240,0,
+    0,0,0,0,0,0,228,255,20,0,0,8,255,240,0,0,
+    0,0,0,0,0,228,255,20,0,0,8,255,240,0,0,0,
+    0,0,0,0,228,255,20,0,0,8,255,240,0,0,0,0,
+    0,0,0,228,255,20,0,0,8,255,240,0,0,0,0,0,
+    0,0,228,255,20,0,0,8,255,240,0,0,0,0,0,0,
+    0,228,255,20,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,8,
+    255,240,0,0,0,8,255,240,0,0,0,8,255,240,0,0,
+    0,8,255,240,0,0,0,8,255,240,0,0,0,8,255,240,
+    0,0,0,8,255,240,0,0,0,8,255,240,0,0,0,8,
+    255,240,0,0,0,8,255,240,0,0,0,8,255,240,0,0,
+    0,8,255,240,0,0,0,8,255,240,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,8,
+    255,240,0,0,0,8,255,240,0,0,0,8,255,240,0,0,
+    0,8,255,240,0,0,0,8,255,240,0,0,0,8,255,240,
+    0,0,0,8,255,240,0,0,0,8,255,240,0,0,0,8,
+    255,240,0,0,0,8,255,240,0,0,0,8,255,240,0,0,
+    0,8,255,240,0,0,0,8,255,239,0,0,0,20,255,229,
+    0,0,0,64,255,199,0,0,45,205,255,138,0,0,255,255,
+    241,30,0,0,239,179,46,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,37,226,255,
+    128,0,8,255,240,0,0,0,0,41,230,255,119,0,0,8,
+    255,240,0,0,0,46,234,255,111,0,0,0,8,255,240,0,
+    0,51,237,254,103,0,0,0,0,8,255,240,0,56,240,253,
+    96,0,0,0,0,0,8,255,240,62,242,251,89,0,0,0,
+    0,0,0,8,255,250,245,250,82,0,0,0,0,0,0,0,
+    8,255,253,253,249,73,0,0,0,0,0,0,0,8,255,240,
+    95,254,247,67,0,0,0,0,0,0,8,255,240,0,102,255,
+    245,61,0,0,0,0,0,8,255,240,0,0,110,255,242,56,
+    0,0,0,0,8,255,240,0,0,0,117,255,240,51,0,0,
+    0,8,255,240,0,0,0,0,125,255,237,46,0,0,8,255,
+    240,0,0,0,0,0,132,255,233,41,0,8,255,240,0,0,
+    0,0,0,0,140,255,230,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,
+    8,255,240,0,0,0,0,0,0,0,0,8,255,240,0,0,
+    0,0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,8,255,240,0,
+    0,0,0,0,0,0,0,8,255,240,0,0,0,0,0,0,
+    0,0,8,255,240,0,0,0,0,0,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,0,
+    0,0,0,8,255,240,0,0,0,0,0,0,0,0,8,255,
+    240,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,8,255,255,255,255,255,255,255,255,255,0,8,
+    255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,255,252,25,0,0,0,0,0,0,
+    211,255,255,76,0,0,8,255,254,255,117,0,0,0,0,0,
+    50,255,254,255,76,0,0,8,255,225,222,211,0,0,0,0,
+    0,145,254,192,255,76,0,0,8,255,224,129,255,49,0,0,
+    0,4,234,192,160,255,76,0,0,8,255,224,35,255,143,0,
+    0,0,78,255,98,160,255,76,0,0,8,255,224,0,195,233,
+    4,0,0,172,246,14,160,255,76,0,0,8,255,224,0,101,
+    255,76,0,17,248,166,0,160,255,76,0,0,8,255,224,0,
+    15,247,170,0,105,255,71,0,160,255,76,0,0,8,255,224,
+    0,0,167,247,16,200,230,3,0,160,255,76,0,0,8,255,
+    224,0,0,73,255,140,255,139,0,0,160,255,76,0,0,8,
+    255,224,0,0,3,230,254,255,45,0,0,160,255,76,0,0,
+    8,255,224,0,0,0,139,255,207,0,0,0,160,255,76,0,
+    0,8,255,224,0,0,0,0,0,0,0,0,0,160,255,76,
+    0,0,8,255,224,0,0,0,0,0,0,0,0,0,160,255,
+    76,0,0,8,255,224,0,0,0,0,0,0,0,0,0,160,
+    255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,255,255,220,4,0,0,0,0,0,236,
+    255,0,0,0,8,255,255,255,101,0,0,0,0,0,236,255,
+    0,0,0,8,255,242,249,225,6,0,0,0,0,236,255,0,
+    0,0,8,255,224,150,255,108,0,0,0,0,236,255,0,0,
+    0,8,255,224,26,247,230,9,0,0,0,236,255,0,0,0,
+    8,255,224,0,142,255,115,0,0,0,236,255,0,0,0,8,
+    255,224,0,21,244,234,12,0,0,236,255,0,0,0,8,255,
+    224,0,0,134,255,123,0,0,236,255,0,0,0,8,255,224,
+    0,0,17,240,238,15,0,236,255,0,0,0,8,255,224,0,
+    0,0,126,255,130,0,236,255,0,0,0,8,255,224,0,0,
+    0,13,236,242,19,236,255,0,0,0,8,255,224,0,0,0,
+    0,118,255,137,236,255,0,0,0,8,255,224,0,0,0,0,
+    10,231,245,246,255,0,0,0,8,255,224,0,0,0,0,0,
+    110,255,255,255,0,0,0,8,255,224,0,0,0,0,0,7,
+    226,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,40,152,219,246,241,207,131,19,0,0,0,0,
+    0,0,0,110,251,255,255,255,255,255,255,237,61,0,0,0,
+    0,0,93,255,255,164,53,9,14,72,200,255,244,39,0,0,
+    0,14,240,255,128,0,0,0,0,0,6,186,255,189,0,0,
+    0,105,255,211,2,0,0,0,0,0,0,28,250,255,41,0,
+    0,171,255,118,0,0,0,0,0,0,0,0,183,255,106,0,
+    0,207,255,70,0,0,0,0,0,0,0,0,135,255,141,0,
+    0,220,255,56,0,0,0,0,0,0,0,0,120,255,155,0,
+    0,207,255,70,0,0,0,0,0,0,0,0,135,255,141,0,
+    0,172,255,117,0,0,0,0,0,0,0,0,182,255,106,0,
+    0,106,255,210,1,0,0,0,0,0,0,27,250,255,42,0,
+    0,15,241,255,124,0,0,0,0,0,5,183,255,190,0,0,
+    0,0,96,255,255,161,51,9,13,70,198,255,245,41,0,0,
+    0,0,0,113,252,255,255,255,255,255,255,238,64,0,0,0,
+    0,0,0,0,42,154,221,247,243,209,132,20,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,8,255,255,255,255,253,234,181,70,0,0,0,8,255,255,
+    255,255,255,255,255,255,107,0,0,8,255,240,0,0,5,43,
+    176,255,243,14,0,8,255,240,0,0,0,0,7,231,255,71,
+    0,8,255,240,0,0,0,0,0,191,255,91,0,8,255,240,
+    0,0,0,0,7,230,255,71,0,8,255,240,0,0,5,42,
+    173,255,244,14,0,8,255,255,255,255,255,255,255,255,107,0,
+    0,8,255,255,255,255,253,235,182,71,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,8,255,240,0,0,0,0,0,0,0,0,
+    0,8,255,240,0,0,0,0,0,0,0,0,0,8,255,240,
+    0,0,0,0,0,0,0,0,0,8,255,240,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,40,152,219,246,241,208,133,20,0,0,0,0,
+    0,0,0,110,251,255,255,255,255,255,255,239,65,0,0,0,
+    0,0,93,255,255,164,53,9,14,72,200,255,246,44,0,0,
+    0,14,240,255,128,0,0,0,0,0,6,186,255,195,0,0,
+    0,105,255,211,2,0,0,0,0,0,0,28,250,255,45,0,
+    0,171,255,118,0,0,0,0,0,0,0,0,183,255,109,0,
+    0,207,255,70,0,0,0,0,0,0,0,0,135,255,142,0,
+    0,220,255,56,0,0,0,0,0,0,0,0,120,255,155,0,
+    0,207,255,70,0,0,0,0,0,0,0,0,135,255,142,0,
+    0,172,255,117,0,0,0,0,0,0,0,0,182,255,103,0,
+    0,106,255,210,1,0,0,0,0,0,0,27,250,254,32,0,
+    0,14,241,255,124,0,0,0,0,0,5,183,255,173,0,0,
+    0,0,95,255,255,161,51,9,13,70,198,255,222,19,0,0,
+    0,0,0,113,252,255,255,255,255,255,255,196,36,0,0,0,
+    0,0,0,0,42,154,221,247,255,255,222,4,0,0,0,0,
+    0,0,0,0,0,0,0,0,15,224,255,122,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,59,252,250,52,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,128,255,217,11,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,8,255,255,255,255,253,238,
+    194,101,2,0,0,0,0,8,255,255,255,255,255,255,255,255,
+    157,0,0,0,0,8,255,240,0,0,4,32,139,255,255,39,
+    0,0,0,8,255,240,0,0,0,0,0,208,255,86,0,0,
+    0,8,255,240,0,0,0,0,0,208,255,74,0,0,0,8,
+    255,240,0,0,4,31,139,255,239,15,0,0,0,8,255,255,
+    255,255,255,255,255,228,65,0,0,0,0,8,255,255,255,255,
+    255,255,253,102,0,0,0,0,0,8,255,240,0,0,14,84,
+    237,254,69,0,0,0,0,8,255,240,0,0,0,0,78,255,
+    214,2,0,0,0,8,255,240,0,0,0,0,0,198,255,82,
+    0,0,0,8,255,240,0,0,0,0,0,85,255,197,0,0,
+    0,8,255,240,0,0,0,0,0,3,225,255,55,0,0,8,
+    255,240,0,0,0,0,0,0,117,255,169,0,0,8,255,240,
+    0,0,0,0,0,0,16,244,252,30,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,96,192,239,249,222,185,105,21,0,
+    0,0,1,172,255,255,255,255,255,255,255,180,0,0,0,86,
+    255,250,119,33,7,28,66,148,157,0,0,0,158,255,128,0,
+    0,0,0,0,0,0,0,0,0,161,255,90,0,0,0,0,
+    0,0,0,0,0,0,114,255,192,15,0,0,0,0,0,0,
+    0,0,0,10,218,255,245,183,130,78,16,0,0,0,0,0,
+    0,20,145,236,255,255,255,249,160,18,0,0,0,0,0,0,
+    2,46,95,157,241,255,211,7,0,0,0,0,0,0,0,0,
+    0,22,222,255,93,0,0,0,0,0,0,0,0,0,0,139,
+    255,140,0,0,0,0,0,0,0,0,0,0,180,255,130,0,
+    0,143,163,83,41,13,12,48,155,255,255,62,0,0,160,255,
+    255,255,255,255,255,255,255,150,0,0,0,15,90,168,213,242,
+    249,228,176,78,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,224,255,24,0,0,0,0,0,0,0,0,0,224,255,24,
+    0,0,0,0,0,0,0,0,0,224,255,24,0,0,0,0,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,224,255,24,0,0,0,0,0,0,0,0,0,224,255,24,
+    0,0,0,0,0,0,0,0,0,224,255,24,0,0,0,0,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,224,255,24,0,0,0,0,0,0,0,0,0,224,255,24,
+    0,0,0,0,0,0,0,0,0,224,255,24,0,0,0,0,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,68,255,184,0,0,0,0,0,0,20,255,
+    232,0,0,0,68,255,184,0,0,0,0,0,0,20,255,232,
+    0,0,0,68,255,184,0,0,0,0,0,0,20,255,232,0,
+    0,0,68,255,184,0,0,0,0,0,0,20,255,232,0,0,
+    0,68,255,184,0,0,0,0,0,0,20,255,232,0,0,0,
+    68,255,184,0,0,0,0,0,0,20,255,232,0,0,0,68,
+    255,184,0,0,0,0,0,0,20,255,232,0,0,0,68,255,
+    184,0,0,0,0,0,0,20,255,232,0,0,0,67,255,184,
+    0,0,0,0,0,0,20,255,231,0,0,0,59,255,194,0,
+    0,0,0,0,0,31,255,222,0,0,0,35,255,231,0,0,
+    0,0,0,0,70,255,197,0,0,0,0,232,255,69,0,0,
+    0,0,0,164,255,139,0,0,0,0,128,255,233,90,18,4,
+    35,143,255,250,38,0,0,0,0,7,190,255,255,255,255,255,
+    255,253,104,0,0,0,0,0,0,5,107,198,240,250,230,172,
+    59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,169,255,102,0,0,0,0,0,
+    0,0,0,183,255,84,74,255,196,0,0,0,0,0,0,0,
+    24,252,238,7,3,231,255,35,0,0,0,0,0,0,115,255,
+    150,0,0,140,255,128,0,0,0,0,0,0,209,255,55,0,
+    0,45,255,221,0,0,0,0,0,45,255,216,0,0,0,0,
+    206,255,59,0,0,0,0,140,255,121,0,0,0,0,111,255,
+    153,0,0,0,3,230,253,29,0,0,0,0,21,250,239,7,
+    0,0,72,255,187,0,0,0,0,0,0,177,255,85,0,0,
+    166,255,92,0,0,0,0,0,0,82,255,178,0,13,245,243,
+    10,0,0,0,0,0,0,6,237,250,21,97,255,158,0,0,
+    0,0,0,0,0,0,148,255,110,191,255,63,0,0,0,0,
+    0,0,0,0,53,255,221,254,223,1,0,0,0,0,0,0,
+    0,0,0,214,255,255,129,0,0,0,0,0,0,0,0,0,
+    0,119,255,255,35,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    53,255,198,0,0,0,0,0,87,255,255,30,0,0,0,0,
+    7,247,248,7,3,243,250,10,0,0,0,0,149,255,255,92,
+    0,0,0,0,61,255,193,0,0,185,255,66,0,0,0,0,
+    211,204,244,154,0,0,0,0,123,255,130,0,0,123,255,128,
+    0,0,0,18,254,138,188,216,0,0,0,0,185,255,68,0,
+    0,61,255,190,0,0,0,79,255,77,128,255,22,0,0,3,
+    242,250,11,0,0,7,247,246,5,0,0,141,254,18,67,255,
+    84,0,0,53,255,198,0,0,0,0,193,255,58,0,0,203,
+    211,0,11,251,146,0,0,115,255,136,0,0,0,0,130,255,
+    119,0,12,251,150,0,0,202,207,0,0,176,255,73,0,0,
+    0,0,68,255,181,0,70,255,89,0,0,142,253,15,1,236,
+    252,14,0,0,0,0,10,250,240,2,132,255,27,0,0,81,
+    255,75,44,255,204,0,0,0,0,0,0,200,255,49,194,222,
+    0,0,0,21,255,137,106,255,141,0,0,0,0,0,0,138,
+    255,118,248,161,0,0,0,0,216,199,168,255,78,0,0,0,
+    0,0,0,76,255,228,255,100,0,0,0,0,156,250,233,254,
+    18,0,0,0,0,0,0,16,253,255,255,39,0,0,0,0,
+    95,255,255,209,0,0,0,0,0,0,0,0,207,255,233,0,
+    0,0,0,0,34,255,255,147,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,106,255,181,0,0,0,0,
+    0,0,177,255,109,0,0,1,194,255,91,0,0,0,0,93,
+    255,193,1,0,0,0,38,247,235,21,0,0,25,238,244,34,
+    0,0,0,0,0,121,255,166,0,0,178,255,108,0,0,0,
+    0,0,0,4,206,255,75,94,255,191,1,0,0,0,0,0,
+    0,0,49,251,228,238,244,33,0,0,0,0,0,0,0,0,
+    0,136,255,255,106,0,0,0,0,0,0,0,0,0,0,99,
+    255,255,64,0,0,0,0,0,0,0,0,0,27,240,245,254,
+    218,8,0,0,0,0,0,0,0,0,183,255,100,154,255,135,
+    0,0,0,0,0,0,0,100,255,185,0,15,229,251,49,0,
+    0,0,0,0,29,241,241,29,0,0,79,255,205,4,0,0,
+    0,0,185,255,99,0,0,0,0,170,255,118,0,0,0,103,
+    255,184,0,0,0,0,0,22,237,246,36,0,31,242,240,28,
+    0,0,0,0,0,0,95,255,191,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    183,255,103,0,0,0,0,0,0,51,252,223,29,242,241,29,
+    0,0,0,0,5,208,255,68,0,103,255,182,0,0,0,0,
+    125,255,156,0,0,1,189,255,95,0,0,42,248,228,15,0,
+    0,0,33,244,238,24,2,199,255,76,0,0,0,0,0,110,
+    255,174,112,255,164,0,0,0,0,0,0,1,195,255,251,233,
+    19,0,0,0,0,0,0,0,37,248,255,85,0,0,0,0,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,224,255,24,0,0,0,0,0,0,0,0,0,224,255,24,
+    0,0,0,0,0,0,0,0,0,224,255,24,0,0,0,0,
+    0,0,0,0,0,224,255,24,0,0,0,0,0,0,0,0,
+    0,224,255,24,0,0,0,0,0,0,0,0,0,224,255,24,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,224,255,255,255,255,255,255,
+    255,255,255,255,148,0,0,224,255,255,255,255,255,255,255,255,
+    255,255,123,0,0,0,0,0,0,0,0,0,0,73,253,195,
+    5,0,0,0,0,0,0,0,0,0,36,239,228,23,0,0,
+    0,0,0,0,0,0,0,12,212,248,54,0,0,0,0,0,
+    0,0,0,0,1,174,255,97,0,0,0,0,0,0,0,0,
+    0,0,125,255,147,0,0,0,0,0,0,0,0,0,0,76,
+    254,193,4,0,0,0,0,0,0,0,0,0,38,240,226,22,
+    0,0,0,0,0,0,0,0,0,13,215,247,51,0,0,0,
+    0,0,0,0,0,0,1,176,255,93,0,0,0,0,0,0,
+    0,0,0,0,128,255,143,0,0,0,0,0,0,0,0,0,
+    0,79,254,190,4,0,0,0,0,0,0,0,0,0,13,242,
+    255,255,255,255,255,255,255,255,255,255,204,0,24,255,255,255,
+    255,255,255,255,255,255,255,255,204,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,72,255,255,255,220,0,0,0,72,255,255,255,220,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,132,0,0,0,0,0,72,255,132,0,0,0,0,
+    0,72,255,255,255,220,0,0,0,72,255,255,255,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,215,208,0,0,
+    0,0,0,134,255,33,0,0,0,0,53,255,114,0,0,0,
+    0,0,227,195,0,0,0,0,0,147,253,23,0,0,0,0,
+    65,255,102,0,0,0,0,3,236,183,0,0,0,0,0,159,
+    249,15,0,0,0,0,78,255,90,0,0,0,0,8,243,171,
+    0,0,0,0,0,171,244,8,0,0,0,0,90,255,77,0,
+    0,0,0,15,249,159,0,0,0,0,0,183,236,3,0,0,
+    0,0,102,255,65,0,0,0,0,23,253,147,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,16,255,255,255,255,20,0,
+    0,16,255,255,255,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,0,0,0,184,255,20,0,
+    0,0,0,0,184,255,20,0,0,16,255,255,255,255,20,0,
+    0,16,255,255,255,255,20,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,49,234,255,203,19,0,0,0,0,0,0,0,0,0,
+    0,0,58,240,247,172,255,212,25,0,0,0,0,0,0,0,
+    0,0,68,244,229,53,0,98,249,220,32,0,0,0,0,0,
+    0,0,80,248,202,26,0,0,0,59,233,228,40,0,0,0,
+    0,0,92,251,166,8,0,0,0,0,0,31,208,234,49,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,
+    223,222,13,0,0,0,0,0,0,0,48,246,156,0,0,0,
+    0,0,0,0,0,90,255,78,0,0,0,0,0,0,0,0,
+    142,233,21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,50,150,212,245,240,193,83,0,0,0,0,0,255,255,
+    255,255,255,255,255,114,0,0,0,0,200,90,36,7,24,98,
+    242,245,16,0,0,0,0,0,0,0,0,0,119,255,76,0,
+    0,0,35,154,220,247,255,255,255,255,104,0,0,42,240,255,
+    255,255,255,255,255,255,112,0,0,160,255,162,47,13,2,0,
+    104,255,112,0,0,196,255,18,0,0,0,0,180,255,112,0,
+    0,165,255,144,26,8,45,162,255,255,112,0,0,58,253,255,
+    255,255,255,252,160,255,112,0,0,0,69,196,241,240,187,61,
+    92,255,112,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,48,255,160,0,0,0,0,0,0,0,0,
+    0,0,48,255,160,0,0,0,0,0,0,0,0,0,0,48,
+    255,160,0,0,0,0,0,0,0,0,0,0,48,255,160,0,
+    0,0,0,0,0,0,0,0,0,48,255,160,34,173,237,245,
+    194,66,0,0,0,0,48,255,184,233,255,255,255,255,252,80,
+    0,0,0,48,255,255,217,67,13,38,162,255,235,10,0,0,
+    48,255,250,37,0,0,0,0,196,255,87,0,0,48,255,195,
+    0,0,0,0,0,103,255,136,0,0,48,255,168,0,0,0,
+    0,0,77,255,151,0,0,48,255,195,0,0,0,0,0,103,
+    255,136,0,0,48,255,250,36,0,0,0,0,194,255,87,0,
+    0,48,255,255,215,65,12,37,158,255,235,10,0,0,48,255,
+    185,234,255,255,255,255,252,81,0,0,0,48,255,160,36,176,
+    238,246,195,67,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,56,170,230,248,219,154,35,0,0,0,104,253,255,
+    255,255,255,255,192,0,0,46,252,254,155,45,11,34,101,156,
+    0,0,151,255,150,0,0,0,0,0,0,0,0,207,255,42,
+    0,0,0,0,0,0,0,0,223,255,10,0,0,0,0,0,
+    0,0,0,207,255,42,0,0,0,0,0,0,0,0,151,255,
+    150,0,0,0,0,0,0,0,0,45,252,254,154,45,10,33,
+    100,156,0,0,0,105,253,255,255,255,255,255,192,0,0,0,
+    0,59,175,234,248,218,152,34,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,236,224,0,
+    0,0,0,0,0,0,0,0,0,0,236,224,0,0,0,0,
+    0,0,0,0,0,0,0,236,224,0,0,0,0,0,0,0,
+    0,0,0,0,236,224,0,0,0,0,2,112,215,248,225,135,
+    7,236,224,0,0,0,0,153,255,255,255,255,255,180,237,224,
+    0,0,0,64,255,246,108,24,23,106,245,255,224,0,0,0,
+    160,255,116,0,0,0,0,111,255,224,0,0,0,209,255,23,
+    0,0,0,0,16,255,224,0,0,0,224,251,0,0,0,0,
+    0,0,245,224,0,0,0,209,255,23,0,0,0,0,16,255,
+    224,0,0,0,160,255,114,0,0,0,0,110,255,224,0,0,
+    0,65,255,245,106,23,22,103,244,255,224,0,0,0,0,154,
+    255,255,255,255,255,181,237,224,0,0,0,0,2,113,217,249,
+    227,139,8,236,224,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,57,173,232,250,229,
+    160,34,0,0,0,0,101,253,255,255,255,255,255,239,44,0,
+    0,41,250,231,94,25,7,34,139,255,195,0,0,147,255,60,
+    0,0,0,0,0,180,255,23,0,204,255,252,252,253,253,254,
+    255,255,255,54,0,223,255,255,255,255,255,255,255,255,255,60,
+    0,208,255,30,0,0,0,0,0,0,0,0,0,152,255,134,
+    0,0,0,0,0,0,0,0,0,43,251,254,148,46,12,19,
+    51,123,177,0,0,0,95,250,255,255,255,255,255,255,212,0,
+    0,0,0,47,161,225,249,234,202,129,33,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,113,214,247,255,0,0,97,255,255,
+    255,255,0,0,179,255,77,5,0,0,0,208,252,0,0,0,
+    140,255,255,255,255,255,240,140,255,255,255,255,255,240,0,0,
+    212,252,0,0,0,0,0,212,252,0,0,0,0,0,212,252,
+    0,0,0,0,0,212,252,0,0,0,0,0,212,252,0,0,
+    0,0,0,212,252,0,0,0,0,0,212,252,0,0,0,0,
+    0,212,252,0,0,0,0,0,212,252,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,115,216,248,225,135,
+    7,236,224,0,0,0,0,157,255,255,255,255,255,180,237,224,
+    0,0,0,67,255,244,105,24,22,101,243,255,224,0,0,0,
+    161,255,111,0,0,0,0,106,255,224,0,0,0,210,255,22,
+    0,0,0,0,15,255,224,0,0,0,224,251,0,0,0,0,
+    0,0,245,224,0,0,0,210,255,22,0,0,0,0,15,255,
+    224,0,0,0,162,255,110,0,0,0,0,105,255,224,0,0,
+    0,68,255,243,102,22,21,99,242,255,224,0,0,0,0,160,
+    255,255,255,255,255,180,239,219,0,0,0,0,3,117,218,249,
+    226,136,21,255,201,0,0,0,0,0,0,0,0,0,0,98,
+    255,154,0,0,0,0,123,111,40,9,32,110,241,255,66,0,
+    0,0,0,148,255,255,255,255,255,255,160,0,0,0,0,0,
+    24,141,211,243,243,202,105,2,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,48,255,160,
+    0,0,0,0,0,0,0,0,0,0,48,255,160,0,0,0,
+    0,0,0,0,0,0,0,48,255,160,0,0,0,0,0,0,
+    0,0,0,0,48,255,160,0,0,0,0,0,0,0,0,0,
+    0,48,255,160,25,163,236,247,203,74,0,0,0,0,48,255,
+    182,226,255,255,255,255,253,61,0,0,0,48,255,255,205,63,
+    12,31,168,255,176,0,0,0,48,255,239,22,0,0,0,12,
+    246,231,0,0,0,48,255,181,0,0,0,0,0,214,249,0,
+    0,0,48,255,160,0,0,0,0,0,208,252,0,0,0,48,
+    255,160,0,0,0,0,0,208,252,0,0,0,48,255,160,0,
+    0,0,0,0,208,252,0,0,0,48,255,160,0,0,0,0,
+    0,208,252,0,0,0,48,255,160,0,0,0,0,0,208,252,
+    0,0,0,48,255,160,0,0,0,0,0,208,252,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,28,255,176,
+    0,0,0,28,255,176,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,28,255,176,0,0,0,28,255,176,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,28,255,176,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,28,255,176,
+    0,0,0,28,255,176,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,28,255,176,0,0,0,28,255,176,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,29,255,175,
+    0,0,0,46,255,164,0,0,12,146,255,127,0,0,255,255,
+    252,42,0,0,251,214,84,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,48,255,160,0,0,0,0,0,0,0,0,0,48,255,160,
+    0,0,0,0,0,0,0,0,0,48,255,160,0,0,0,0,
+    0,0,0,0,0,48,255,160,0,0,0,0,0,0,0,0,
+    0,48,255,160,0,0,0,2,146,255,174,8,0,48,255,160,
+    0,0,8,172,255,148,2,0,0,48,255,160,0,18,195,254,
+    119,0,0,0,0,48,255,160,31,215,250,91,0,0,0,0,
+    0,48,255,199,230,241,67,0,0,0,0,0,0,48,255,237,
+    255,207,17,0,0,0,0,0,0,48,255,160,121,255,206,20,
+    0,0,0,0,0,48,255,160,0,112,255,211,23,0,0,0,
+    0,48,255,160,0,0,104,254,216,26,0,0,0,48,255,160,
+    0,0,0,96,253,220,30,0,0,48,255,160,0,0,0,0,
+    89,251,224,34,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,28,255,176,0,0,0,28,255,176,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,28,255,176,
+    0,0,0,28,255,176,0,0,0,28,255,176,0,0,0,28,
+    255,176,0,0,0,28,255,176,0,0,0,28,255,176,0,0,
+    0,28,255,176,0,0,0,28,255,176,0,0,0,28,255,176,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,48,255,160,32,171,237,242,
+    180,36,0,23,158,232,247,195,50,0,0,0,48,255,183,231,
+    255,255,255,255,226,30,223,255,255,255,255,237,15,0,0,48,
+    255,255,200,56,11,45,208,255,232,210,64,12,38,195,255,117,
+    0,0,48,255,238,19,0,0,0,73,255,247,30,0,0,0,
+    50,255,166,0,0,48,255,180,0,0,0,0,34,255,200,0,
+    0,0,0,10,255,194,0,0,48,255,160,0,0,0,0,28,
+    255,180,0,0,0,0,4,255,200,0,0,48,255,160,0,0,
+    0,0,28,255,180,0,0,0,0,4,255,200,0,0,48,255,
+    160,0,0,0,0,28,255,180,0,0,0,0,4,255,200,0,
+    0,48,255,160,0,0,0,0,28,255,180,0,0,0,0,4,
+    255,200,0,0,48,255,160,0,0,0,0,28,255,180,0,0,
+    0,0,4,255,200,0,0,48,255,160,0,0,0,0,28,255,
+    180,0,0,0,0,4,255,200,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,48,255,160,25,163,236,247,203,74,0,0,0,0,48,255,
+    182,226,255,255,255,255,253,61,0,0,0,48,255,255,205,63,
+    12,31,168,255,176,0,0,0,48,255,239,22,0,0,0,12,
+    246,231,0,0,0,48,255,181,0,0,0,0,0,214,249,0,
+    0,0,48,255,160,0,0,0,0,0,208,252,0,0,0,48,
+    255,160,0,0,0,0,0,208,252,0,0,0,48,255,160,0,
+    0,0,0,0,208,252,0,0,0,48,255,160,0,0,0,0,
+    0,208,252,0,0,0,48,255,160,0,0,0,0,0,208,252,
+    0,0,0,48,255,160,0,0,0,0,0,208,252,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,88,195,242,247,211,120,7,0,0,0,0,138,255,
+    255,255,255,255,255,192,5,0,0,61,255,250,120,29,18,89,
+    237,255,122,0,0,159,255,131,0,0,0,0,76,255,222,0,
+    0,209,255,36,0,0,0,0,0,233,255,16,0,224,255,9,
+    0,0,0,0,0,205,255,31,0,209,255,36,0,0,0,0,
+    0,233,255,16,0,160,255,131,0,0,0,0,74,255,222,0,
+    0,62,255,250,120,28,17,87,235,255,123,0,0,0,141,255,
+    255,255,255,255,255,194,6,0,0,0,0,91,197,243,248,212,
+    123,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,48,255,160,34,173,237,245,
+    194,66,0,0,0,0,48,255,184,233,255,255,255,255,252,80,
+    0,0,0,48,255,255,217,67,13,38,162,255,235,10,0,0,
+    48,255,250,37,0,0,0,0,196,255,87,0,0,48,255,195,
+    0,0,0,0,0,103,255,136,0,0,48,255,168,0,0,0,
+    0,0,77,255,151,0,0,48,255,195,0,0,0,0,0,103,
+    255,136,0,0,48,255,250,36,0,0,0,0,194,255,87,0,
+    0,48,255,255,215,65,12,37,158,255,235,10,0,0,48,255,
+    185,234,255,255,255,255,252,81,0,0,0,48,255,160,36,176,
+    238,246,195,67,0,0,0,0,48,255,160,0,0,0,0,0,
+    0,0,0,0,0,48,255,160,0,0,0,0,0,0,0,0,
+    0,0,48,255,160,0,0,0,0,0,0,0,0,0,0,48,
+    255,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,2,112,215,248,225,135,7,236,224,0,0,0,0,153,
+    255,255,255,255,255,180,237,224,0,0,0,64,255,246,108,24,
+    23,106,245,255,224,0,0,0,160,255,116,0,0,0,0,111,
+    255,224,0,0,0,209,255,23,0,0,0,0,16,255,224,0,
+    0,0,224,251,0,0,0,0,0,0,245,224,0,0,0,209,
+    255,23,0,0,0,0,16,255,224,0,0,0,160,255,114,0,
+    0,0,0,110,255,224,0,0,0,65,255,245,106,23,22,103,
+    244,255,224,0,0,0,0,154,255,255,255,255,255,181,237,224,
+    0,0,0,0,2,113,217,249,227,139,8,236,224,0,0,0,
+    0,0,0,0,0,0,0,0,236,224,0,0,0,0,0,0,
+    0,0,0,0,0,236,224,0,0,0,0,0,0,0,0,0,
+    0,0,236,224,0,0,0,0,0,0,0,0,0,0,0,236,
+    224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,48,255,160,31,166,234,254,0,48,255,184,232,255,255,255,
+    0,48,255,255,210,65,12,0,0,48,255,246,29,0,0,0,
+    0,48,255,191,0,0,0,0,0,48,255,162,0,0,0,0,
+    0,48,255,160,0,0,0,0,0,48,255,160,0,0,0,0,
+    0,48,255,160,0,0,0,0,0,48,255,160,0,0,0,0,
+    0,48,255,160,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,73,187,230,246,216,157,43,0,0,94,255,255,255,255,
+    255,255,220,0,0,197,255,124,27,7,35,95,175,0,0,197,
+    247,1,0,0,0,0,0,0,0,111,255,176,77,19,0,0,
+    0,0,0,1,94,200,253,255,220,140,24,0,0,0,0,0,
+    13,61,127,240,224,16,0,0,0,0,0,0,0,122,255,89,
+    0,194,117,48,14,10,56,210,255,91,0,236,255,255,255,255,
+    255,255,220,13,0,41,137,206,241,240,211,128,19,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,36,255,168,0,0,0,0,
+    0,36,255,168,0,0,0,0,0,36,255,168,0,0,0,0,
+    120,255,255,255,255,255,255,92,120,255,255,255,255,255,255,92,
+    0,36,255,168,0,0,0,0,0,36,255,168,0,0,0,0,
+    0,36,255,168,0,0,0,0,0,36,255,168,0,0,0,0,
+    0,36,255,168,0,0,0,0,0,32,255,175,0,0,0,0,
+    0,10,254,230,37,2,0,0,0,0,191,255,255,255,255,92,
+    0,0,31,174,237,254,255,92,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,76,255,128,0,0,0,0,
+    0,240,220,0,0,0,76,255,128,0,0,0,0,0,240,220,
+    0,0,0,76,255,128,0,0,0,0,0,240,220,0,0,0,
+    76,255,128,0,0,0,0,0,240,220,0,0,0,76,255,128,
+    0,0,0,0,0,240,220,0,0,0,76,255,128,0,0,0,
+    0,0,240,220,0,0,0,73,255,134,0,0,0,0,8,252,
+    220,0,0,0,56,255,177,0,0,0,0,83,255,220,0,0,
+    0,10,246,253,103,16,22,96,237,255,220,0,0,0,0,138,
+    255,255,255,255,255,168,240,220,0,0,0,0,3,126,224,250,
+    223,126,4,240,220,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,57,255,174,0,0,0,0,0,
+    0,215,249,18,0,216,250,19,0,0,0,0,54,255,172,0,
+    0,121,255,108,0,0,0,0,149,255,77,0,0,28,253,203,
+    0,0,0,6,237,233,4,0,0,0,186,255,42,0,0,83,
+    255,142,0,0,0,0,90,255,137,0,0,178,255,47,0,0,
+    0,0,9,241,229,3,21,251,208,0,0,0,0,0,0,155,
+    255,71,112,255,113,0,0,0,0,0,0,59,255,165,206,251,
+    22,0,0,0,0,0,0,0,219,250,255,178,0,0,0,0,
+    0,0,0,0,124,255,255,83,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,12,250,197,0,0,0,9,248,
+    255,93,0,0,0,106,255,98,0,196,251,13,0,0,68,255,
+    255,160,0,0,0,172,255,31,0,130,255,75,0,0,135,252,
+    190,227,0,0,2,236,221,0,0,63,255,142,0,0,202,201,
+    107,255,38,0,50,255,154,0,0,6,246,209,0,15,252,134,
+    41,255,105,0,116,255,88,0,0,0,186,254,22,79,255,67,
+    0,229,172,0,183,254,22,0,0,0,120,255,88,146,248,8,
+    0,164,237,7,244,211,0,0,0,0,53,255,155,212,189,0,
+    0,97,255,112,255,144,0,0,0,0,2,239,234,255,122,0,
+    0,30,255,233,255,78,0,0,0,0,0,176,255,255,55,0,
+    0,0,220,255,252,15,0,0,0,0,0,109,255,241,3,0,
+    0,0,153,255,201,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,176,255,109,0,0,0,0,
+    131,255,156,0,0,18,225,248,49,0,0,67,253,213,10,0,
+    0,0,58,251,218,12,22,231,246,43,0,0,0,0,0,120,
+    255,165,186,255,100,0,0,0,0,0,0,1,184,255,255,166,
+    0,0,0,0,0,0,0,0,103,255,255,54,0,0,0,0,
+    0,0,0,37,243,238,253,210,8,0,0,0,0,0,7,206,
+    254,69,132,255,152,0,0,0,0,0,147,255,135,0,3,196,
+    255,86,0,0,0,80,255,198,4,0,0,29,237,241,34,0,
+    30,238,239,31,0,0,0,0,79,255,202,6,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,51,255,178,0,0,0,0,0,
+    0,218,245,16,0,201,252,27,0,0,0,0,65,255,154,0,
+    0,95,255,126,0,0,0,0,167,255,47,0,0,8,236,225,
+    2,0,0,19,248,195,0,0,0,0,139,255,73,0,0,114,
+    255,88,0,0,0,0,34,254,175,0,0,215,231,5,0,0,
+    0,0,0,183,251,25,62,255,129,0,0,0,0,0,0,77,
+    255,122,163,251,27,0,0,0,0,0,0,2,224,226,247,171,
+    0,0,0,0,0,0,0,0,121,255,255,63,0,0,0,0,
+    0,0,0,0,25,255,211,0,0,0,0,0,0,0,0,0,
+    84,255,106,0,0,0,0,0,0,0,1,44,226,245,16,0,
+    0,0,0,0,0,108,255,255,255,138,0,0,0,0,0,0,
+    0,108,255,237,152,7,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,228,255,255,255,255,255,255,255,164,0,0,228,255,255,255,
+    255,255,255,255,139,0,0,0,0,0,0,0,11,201,191,7,
+    0,0,0,0,0,0,5,183,207,14,0,0,0,0,0,0,
+    1,163,221,23,0,0,0,0,0,0,0,141,233,36,0,0,
+    0,0,0,0,0,118,242,50,0,0,0,0,0,0,0,95,
+    248,67,0,0,0,0,0,0,0,74,249,86,0,0,0,0,
+    0,0,0,22,245,255,255,255,255,255,255,255,164,0,36,255,
+    255,255,255,255,255,255,255,164,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,74,193,238,253,56,0,
+    0,0,0,0,0,0,27,249,255,255,255,56,0,0,0,0,
+    0,0,0,92,255,185,29,3,0,0,0,0,0,0,0,0,
+    115,255,98,0,0,0,0,0,0,0,0,0,0,120,255,88,
+    0,0,0,0,0,0,0,0,0,0,120,255,87,0,0,0,
+    0,0,0,0,0,0,0,143,255,74,0,0,0,0,0,0,
+    0,0,10,61,234,254,30,0,0,0,0,0,0,0,128,255,
+    255,237,111,0,0,0,0,0,0,0,0,128,255,255,236,110,
+    0,0,0,0,0,0,0,0,0,12,72,242,254,31,0,0,
+    0,0,0,0,0,0,0,0,152,255,75,0,0,0,0,0,
+    0,0,0,0,0,123,255,87,0,0,0,0,0,0,0,0,
+    0,0,120,255,88,0,0,0,0,0,0,0,0,0,0,115,
+    255,98,0,0,0,0,0,0,0,0,0,0,93,255,185,28,
+    3,0,0,0,0,0,0,0,0,28,250,255,255,255,56,0,
+    0,0,0,0,0,0,0,77,195,240,254,56,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,116,255,52,0,0,0,0,116,255,52,
+    0,0,0,0,116,255,52,0,0,0,0,116,255,52,0,0,
+    0,0,116,255,52,0,0,0,0,116,255,52,0,0,0,0,
+    116,255,52,0,0,0,0,116,255,52,0,0,0,0,116,255,
+    52,0,0,0,0,116,255,52,0,0,0,0,116,255,52,0,
+    0,0,0,116,255,52,0,0,0,0,116,255,52,0,0,0,
+    0,116,255,52,0,0,0,0,116,255,52,0,0,0,0,116,
+    255,52,0,0,0,0,116,255,52,0,0,0,0,116,255,52,
+    0,0,0,0,116,255,52,0,0,0,0,116,255,52,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,128,251,230,172,35,0,0,0,0,0,
+    0,0,0,128,255,255,255,202,0,0,0,0,0,0,0,0,
+    0,6,48,234,255,17,0,0,0,0,0,0,0,0,0,0,
+    171,255,39,0,0,0,0,0,0,0,0,0,0,160,255,44,
+    0,0,0,0,0,0,0,0,0,0,159,255,44,0,0,0,
+    0,0,0,0,0,0,0,148,255,66,0,0,0,0,0,0,
+    0,0,0,0,102,255,188,37,4,0,0,0,0,0,0,0,
+    0,9,163,250,255,255,56,0,0,0,0,0,0,0,8,160,
+    250,255,255,56,0,0,0,0,0,0,0,102,255,201,44,5,
+    0,0,0,0,0,0,0,0,148,255,76,0,0,0,0,0,
+    0,0,0,0,0,159,255,47,0,0,0,0,0,0,0,0,
+    0,0,160,255,44,0,0,0,0,0,0,0,0,0,0,170,
+    255,39,0,0,0,0,0,0,0,0,6,45,232,255,17,0,
+    0,0,0,0,0,0,128,255,255,255,204,0,0,0,0,0,
+    0,0,0,128,251,232,174,37,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    12,0,0,0,0,5,108,205,247,240,197,132,66,17,8,55,
+    154,159,0,0,0,0,191,255,255,255,255,255,255,255,255,255,
+    255,255,131,0,0,0,0,222,156,48,7,26,82,148,210,245,
+    242,187,76,0,0,0,0,0,53,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+#endif // GLYPHDATA_H
@@ -0,0 +1,166 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "glyphlabel.h"
+#include "glyphdata.h"
+#include "litewindow.h"
+#include <QPainter>
+
+/**
+ * @brief Finds the glyph for a character
+ * @param c The character
+ * @return Its index in the glyph set
+ */
+static int glyphIndex(QChar c)
+{
+    ushort const code = c.unicode();
+    if (code < GLYPH_FIRST || code >= GLYPH_FIRST + GLYPH_COUNT) {
+        return '?' - GLYPH_FIRST;
+    }
+    return code - GLYPH_FIRST;
+}
+
+/**
+ * @brief Constructor for GlyphLabel
+ * @param parent The window it's drawn on
+ */
+GlyphLabel::GlyphLabel(LiteWindow *parent) :
+    _parent(parent)
+{
+    _parent->addLabel(this);
+}
+
+/**
+ * @brief Destructor for GlyphLabel
+ */
+GlyphLabel::~GlyphLabel()
+{
+    _parent->removeLabel(this);
+}
+
+/**
+ * @brief Changes the text, and schedules the label's area for repainting
+ * @param text The new text
+ */
+void GlyphLabel::setText(QString const &text)
+{
+    if (text == _text) {
+        return;
+    }
+    _text = text;
+    _image = render(_text);
+    _parent->update(_geometry);
+}
+
+/**
+ * @brief Moves the label, and schedules both its old and new areas for repainting
+ * @param x The left edge
+ * @param y The top edge
+ * @param w The width
+ * @param h The height
+ */
+void GlyphLabel::setGeometry(int x, int y, int w, int h)
+{
+    _parent->update(_geometry);
+    _geometry = QRect(x, y, w, h);
+    _parent->update(_geometry);
+}
+
+/**
+ * @brief Gets the size needed to show all of the text
+ * @return The size in pixels
+ */
+QSize GlyphLabel::sizeHint() const
+{
+    return QSize(_text.isEmpty() ? 0 : _image.width(), GLYPH_HEIGHT);
+}
+
+/**
+ * @brief Draws the text centered in the label's area
+ * @param p The painter to draw with
+ */
+void GlyphLabel::paint(QPainter &p) const
+{
+    if (_text.isEmpty()) {
+        return;
+    }
+    drawCentered(p, _geometry, _image);
+}
+
+/**
+ * @brief Draws a line of text centered in an area, without a label
+ * @param p The painter to draw with
+ * @param rect The area; anything outside of it is clipped
+ * @param text The text
+ *
+ * This stands in for QPainter::drawText() for text that's only drawn once,
+ * such as into an image.
+ */
+void GlyphLabel::drawText(QPainter &p, QRect const &rect, QString const &text)
+{
+    if (text.isEmpty()) {
+        return;
+    }
+    drawCentered(p, rect, render(text));
+}
+
+/**
+ * @brief Builds an image of a line of text out of the glyphs
+ * @param text The text
+ * @return Black text on a transparent background, exactly as wide as the text
+ */
+QImage GlyphLabel::render(QString const &text)
+{
+    int width = 0;
+    for (QChar const c : text) {
+        width += glyphWidths[glyphIndex(c)];
+    }
+
+    // Black with the glyph's coverage as alpha, premultiplied, so the color channels stay 0
+    QImage image(qMax(width, 1), GLYPH_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    int left = 0;
+    for (QChar const c : text) {
+        int const index = glyphIndex(c);
+        int const glyphWidth = glyphWidths[index];
+        unsigned char const *alpha = glyphAlpha + glyphOffsets[index];
+        for (int y = 0; y < GLYPH_HEIGHT; y++) {
+            QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y)) + left;
+            for (int x = 0; x < glyphWidth; x++) {
+                line[x] = static_cast<QRgb>(alpha[y * glyphWidth + x]) << 24;
+            }
+        }
+        left += glyphWidth;
+    }
+    return image;
+}
+
+/**
+ * @brief Draws rendered text centered in an area
+ * @param p The painter to draw with
+ * @param rect The area; anything outside of it is clipped
+ * @param image The text, from render()
+ */
+void GlyphLabel::drawCentered(QPainter &p, QRect const &rect, QImage const &image)
+{
+    p.save();
+    p.setClipRect(rect, Qt::IntersectClip);
+    p.drawImage(rect.x() + (rect.width() - image.width()) / 2,
+                rect.y() + (rect.height() - image.height()) / 2, image);
+    p.restore();
+}
@@ -0,0 +1,64 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GLYPHLABEL_H
+#define GLYPHLABEL_H
+
+#include <QImage>
+#include <QRect>
+#include <QSize>
+#include <QString>
+
+class LiteWindow;
+class QPainter;
+
+/**
+ * @brief One centered line of black text for the lite build, standing in for QLabel
+ *
+ * The text is built out of the pre-rasterized glyphs in glyphdata.h, so no
+ * fonts are loaded at all. The string is rendered into an image once when it
+ * changes, and each repaint just draws that image. Only printable ASCII is
+ * available; anything else shows up as a question mark.
+ */
+class GlyphLabel
+{
+public:
+    GlyphLabel(LiteWindow *parent);
+    ~GlyphLabel();
+
+    void setText(QString const &text);
+    QString const &text() const { return _text; }
+    void setGeometry(int x, int y, int w, int h);
+    QRect const &geometry() const { return _geometry; }
+    QSize sizeHint() const;
+    void paint(QPainter &p) const;
+    static void drawText(QPainter &p, QRect const &rect, QString const &text);
+
+private:
+    Q_DISABLE_COPY(GlyphLabel)
+
+    static QImage render(QString const &text);
+    static void drawCentered(QPainter &p, QRect const &rect, QImage const &image);
+
+    LiteWindow *_parent;
+    QString _text;
+    QImage _image;
+    QRect _geometry;
+};
+
+#endif // GLYPHLABEL_H
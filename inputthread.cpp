@@ -0,0 +1,173 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputthread.h"
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructor for InputThread
+ * @param fd The touchscreen's (non-blocking) file descriptor. It is not owned by this object.
+ * @param recorder If not null, every raw event is also written here (from the input thread)
+ * @param parent The parent object
+ */
+InputThread::InputThread(int fd, CaptureWriter *recorder, QObject *parent) :
+    QThread(parent),
+    _fd(fd),
+    _recorder(recorder),
+    _notifyFd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+    _stopFd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+    _queueOverflows(0)
+{
+    _decoder.setDevice(fd);
+    if (_notifyFd < 0 || _stopFd < 0) {
+        qCritical("Unable to create eventfds for the input thread");
+    }
+}
+
+/**
+ * @brief Destructor for InputThread
+ */
+InputThread::~InputThread()
+{
+    stop();
+    if (_notifyFd >= 0) {
+        ::close(_notifyFd);
+    }
+    if (_stopFd >= 0) {
+        ::close(_stopFd);
+    }
+}
+
+/**
+ * @brief Takes the oldest decoded sample off the queue (GUI thread only)
+ * @param sample Filled in with the sample
+ * @return True if a sample was available, false if the queue is empty
+ */
+bool InputThread::takeSample(TouchSample &sample)
+{
+    return _queue.pop(sample);
+}
+
+/**
+ * @brief Clears the notification eventfd (GUI thread only)
+ *
+ * Call this before draining the queue with takeSample(), so that samples
+ * queued while draining will trigger another notification.
+ */
+void InputThread::acknowledge()
+{
+    uint64_t value;
+    ssize_t result = ::read(_notifyFd, &value, sizeof(value));
+    Q_UNUSED(result);
+}
+
+/**
+ * @brief Asks the thread to exit and waits for it to do so
+ */
+void InputThread::stop()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+    uint64_t const one = 1;
+    ssize_t result = ::write(_stopFd, &one, sizeof(one));
+    Q_UNUSED(result);
+    wait();
+}
+
+/**
+ * @brief Prints input statistics; only valid once the thread has stopped
+ *
+ * The same goes for eventReader(), decoder() and queueOverflows().
+ */
+void InputThread::logStatistics() const
+{
+    _eventReader.logStatistics();
+    _decoder.logStatistics();
+    if (_queueOverflows > 0) {
+        qDebug("Input queue overflowed, %lu samples dropped", _queueOverflows);
+    }
+}
+
+/**
+ * @brief The thread's main loop: wait for events, decode them and queue the samples
+ */
+void InputThread::run()
+{
+    pollfd fds[2];
+    fds[0].fd = _fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = _stopFd;
+    fds[1].events = POLLIN;
+
+    for (;;) {
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            qCritical("Input thread poll failed");
+            return;
+        }
+
+        // Leave when we're asked to, or if the device went away
+        if (fds[1].revents) {
+            return;
+        }
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            qCritical("Touchscreen device error in input thread");
+            return;
+        }
+
+        bool queued = false;
+        int count;
+        _eventReader.beginWakeup();
+        while ((count = _eventReader.readBatch(_fd)) > 0) {
+            input_event const *events = _eventReader.events();
+            if (_recorder) {
+                _recorder->write(events, count);
+            }
+            for (int i = 0; i < count; i++) {
+                if (_decoder.processEvent(events[i])) {
+                    TouchSample sample = _decoder.sample();
+                    sample.readTime = _eventReader.readTime();
+                    if (_queue.push(sample)) {
+                        queued = true;
+                    } else {
+                        _queueOverflows++;
+                    }
+                }
+            }
+            if (count < EVENT_BATCH_SIZE) {
+                break;
+            }
+        }
+        _eventReader.endWakeup();
+
+        // Wake up the GUI thread once for the whole batch
+        if (queued) {
+            uint64_t const one = 1;
+            ssize_t result = ::write(_notifyFd, &one, sizeof(one));
+            Q_UNUSED(result);
+        }
+    }
+}
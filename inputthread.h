@@ -0,0 +1,70 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INPUTTHREAD_H
+#define INPUTTHREAD_H
+
+#include <QThread>
+#include "capturefile.h"
+#include "eventreader.h"
+#include "touchdecoder.h"
+#include "spscqueue.h"
+
+/// Number of decoded samples that can be waiting for the GUI thread
+#define INPUT_QUEUE_SIZE                256
+
+/**
+ * @brief Thread that reads and decodes touchscreen events independently of the GUI
+ *
+ * Decoded samples are handed to the GUI thread through a lock-free queue. The
+ * GUI thread is woken up through an eventfd (see notifyFd()) at most once per
+ * batch of events, so it can watch it with a QSocketNotifier.
+ */
+class InputThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    InputThread(int fd, CaptureWriter *recorder = nullptr, QObject *parent = nullptr);
+    ~InputThread();
+
+    int notifyFd() const { return _notifyFd; }
+    void setClock(clockid_t clock) { _eventReader.setClock(clock); }
+    bool takeSample(TouchSample &sample);
+    void acknowledge();
+    void stop();
+    EventReader const &eventReader() const { return _eventReader; }
+    TouchDecoder const &decoder() const { return _decoder; }
+    unsigned long queueOverflows() const { return _queueOverflows; }
+    void logStatistics() const;
+
+protected:
+    void run();
+
+private:
+    int _fd;
+    CaptureWriter *_recorder;
+    int _notifyFd;
+    int _stopFd;
+    EventReader _eventReader;
+    TouchDecoder _decoder;
+    SpscQueue<TouchSample, INPUT_QUEUE_SIZE> _queue;
+    unsigned long _queueOverflows;
+};
+
+#endif // INPUTTHREAD_H
@@ -0,0 +1,147 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "latencystats.h"
+#include <QtGlobal>
+#include <string.h>
+
+/// Names of the stages, for printing
+static char const * const stageNames[LatencyStats::NumStages] = {
+    "kernel to read",
+    "read to handle",
+    "handle to paint"
+};
+
+/**
+ * @brief Constructor for LatencyStats
+ */
+LatencyStats::LatencyStats() :
+    _clock(CLOCK_REALTIME)
+{
+    memset(_stages, 0, sizeof(_stages));
+}
+
+/**
+ * @brief Reads the clock that the kernel's event timestamps are using
+ * @return The current time
+ */
+timeval LatencyStats::now() const
+{
+    timespec ts;
+    clock_gettime(_clock, &ts);
+    timeval tv;
+    tv.tv_sec = ts.tv_sec;
+    tv.tv_usec = ts.tv_nsec / 1000;
+    return tv;
+}
+
+/**
+ * @brief Adds one frame's time through a stage to the statistics
+ * @param stage The stage that was timed
+ * @param start When the frame entered the stage
+ * @param end When the frame left the stage
+ */
+void LatencyStats::record(Stage stage, timeval const &start, timeval const &end)
+{
+    // An unset start time means the frame wasn't timed (e.g. it was replayed)
+    if (start.tv_sec == 0 && start.tv_usec == 0) {
+        return;
+    }
+
+    // If the clocks don't agree we can end up going backwards; count it as zero
+    long micros = static_cast<long>(end.tv_sec - start.tv_sec) * 1000000L +
+                  static_cast<long>(end.tv_usec - start.tv_usec);
+    if (micros < 0) {
+        micros = 0;
+    }
+
+    Histogram &h = _stages[stage];
+    h.count++;
+    h.totalMicroseconds += static_cast<unsigned long long>(micros);
+    if (micros > h.maxMicroseconds) {
+        h.maxMicroseconds = micros;
+    }
+
+    // Bucket 0 holds 0 us, bucket N holds 2^(N-1) to 2^N - 1 us
+    int bucket = 0;
+    for (long n = micros; n > 0 && bucket < LATENCY_HISTOGRAM_BUCKETS - 1; n >>= 1) {
+        bucket++;
+    }
+    h.buckets[bucket]++;
+}
+
+/**
+ * @brief Calculates the average time frames spent in a stage
+ * @param stage The stage
+ * @return The mean in microseconds, or 0 if no frames have been timed
+ */
+double LatencyStats::meanMicroseconds(Stage stage) const
+{
+    Histogram const &h = _stages[stage];
+    if (h.count == 0) {
+        return 0;
+    }
+    return static_cast<double>(h.totalMicroseconds) / static_cast<double>(h.count);
+}
+
+/**
+ * @brief Prints a summary and histogram of each stage's latency
+ */
+void LatencyStats::logStatistics() const
+{
+    for (int s = 0; s < NumStages; s++) {
+        Histogram const &h = _stages[s];
+        if (h.count == 0) {
+            continue;
+        }
+
+        // Percentiles can only be narrowed down to a bucket, so report its upper end
+        unsigned long const p50Target = (h.count + 1) / 2;
+        unsigned long const p99Target = h.count - h.count / 100;
+        long p50 = -1, p99 = -1;
+        unsigned long seen = 0;
+        for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+            seen += h.buckets[i];
+            long const high = i == 0 ? 0 : (1L << i) - 1;
+            if (p50 < 0 && seen >= p50Target) {
+                p50 = high;
+            }
+            if (p99 < 0 && seen >= p99Target) {
+                p99 = high;
+            }
+        }
+        p50 = qMin(p50, h.maxMicroseconds);
+        p99 = qMin(p99, h.maxMicroseconds);
+
+        qDebug("Latency, %s: %lu frames, mean %.0f us, p50 <= %ld us, p99 <= %ld us, max %ld us",
+               stageNames[s], h.count, meanMicroseconds(static_cast<Stage>(s)),
+               p50, p99, h.maxMicroseconds);
+        for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+            if (h.buckets[i] == 0) {
+                continue;
+            }
+            long low = i == 0 ? 0 : (1L << (i - 1));
+            long high = i == 0 ? 0 : (1L << i) - 1;
+            if (i == LATENCY_HISTOGRAM_BUCKETS - 1) {
+                qDebug("  %7ld+        us: %lu", low, h.buckets[i]);
+            } else {
+                qDebug("  %7ld-%-7ld us: %lu", low, high, h.buckets[i]);
+            }
+        }
+    }
+}
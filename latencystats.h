@@ -0,0 +1,78 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATENCYSTATS_H
+#define LATENCYSTATS_H
+
+#include <sys/time.h>
+#include <time.h>
+
+/// Number of buckets in each latency histogram (powers of two, in microseconds)
+#define LATENCY_HISTOGRAM_BUCKETS       20
+
+/**
+ * @brief Keeps track of how long each touch frame spends getting to the screen
+ *
+ * Each frame is timed in three stages: from the kernel timestamping its
+ * SYN_REPORT until we read it (scheduling), from the read until the GUI
+ * thread handles it (the Qt event loop, and the input queue if it's used),
+ * and from handling it until the resulting repaint finishes (painting).
+ * All of the times have to come from the same clock as the kernel's event
+ * timestamps; see setClock().
+ */
+class LatencyStats
+{
+public:
+    /// The stages a touch frame is timed through
+    enum Stage
+    {
+        /// Kernel timestamp of the SYN_REPORT until the read() that returned it
+        KernelToRead,
+        /// The read() until the GUI thread handled the frame
+        ReadToHandle,
+        /// Handling the frame until the resulting paintEvent() finished
+        HandleToPaint,
+        /// Number of stages; not a stage itself
+        NumStages
+    };
+
+    LatencyStats();
+
+    void setClock(clockid_t clock) { _clock = clock; }
+    timeval now() const;
+    void record(Stage stage, timeval const &start, timeval const &end);
+    unsigned long frames(Stage stage) const { return _stages[stage].count; }
+    double meanMicroseconds(Stage stage) const;
+    long maxMicroseconds(Stage stage) const { return _stages[stage].maxMicroseconds; }
+    void logStatistics() const;
+
+private:
+    /// Timing statistics for one stage
+    struct Histogram
+    {
+        unsigned long count;
+        unsigned long long totalMicroseconds;
+        long maxMicroseconds;
+        unsigned long buckets[LATENCY_HISTOGRAM_BUCKETS];
+    };
+
+    clockid_t _clock;
+    Histogram _stages[NumStages];
+};
+
+#endif // LATENCYSTATS_H
@@ -0,0 +1,173 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "litewindow.h"
+#include "glyphlabel.h"
+#include <QBackingStore>
+#include <QEvent>
+#include <QPaintEvent>
+#include <QPainter>
+
+/**
+ * @brief Constructor for LiteWindow
+ * @param parent The parent window, which should be nullptr because this is a full-screen window.
+ */
+LiteWindow::LiteWindow(QWindow *parent) :
+    QWindow(parent),
+    _backingStore(new QBackingStore(this))
+{
+    setSurfaceType(QSurface::RasterSurface);
+}
+
+/**
+ * @brief Destructor for LiteWindow
+ */
+LiteWindow::~LiteWindow()
+{
+    delete _backingStore;
+}
+
+/**
+ * @brief Schedules a repaint of the whole window
+ */
+void LiteWindow::update()
+{
+    update(QRect(QPoint(), size()));
+}
+
+/**
+ * @brief Schedules a repaint of part of the window
+ * @param rect The area that needs to be redrawn
+ *
+ * Like QWidget::update(), calls are merged until the next update request.
+ */
+void LiteWindow::update(QRect const &rect)
+{
+    if (rect.isEmpty()) {
+        return;
+    }
+    _dirty += rect;
+    requestUpdate();
+}
+
+/**
+ * @brief Schedules a repaint of several parts of the window
+ * @param region The area that needs to be redrawn
+ */
+void LiteWindow::update(QRegion const &region)
+{
+    if (region.isEmpty()) {
+        return;
+    }
+    _dirty += region;
+    requestUpdate();
+}
+
+/**
+ * @brief Adds a label to be drawn on top of the window's own painting
+ * @param label The label
+ */
+void LiteWindow::addLabel(GlyphLabel *label)
+{
+    _labels.append(label);
+}
+
+/**
+ * @brief Stops drawing a label
+ * @param label The label
+ */
+void LiteWindow::removeLabel(GlyphLabel *label)
+{
+    _labels.removeOne(label);
+}
+
+/**
+ * @brief Handles the update requests that update() asks for
+ * @param event The event
+ * @return True if the event was handled
+ */
+bool LiteWindow::event(QEvent *event)
+{
+    if (event->type() == QEvent::UpdateRequest) {
+        render();
+        return true;
+    }
+    return QWindow::event(event);
+}
+
+/**
+ * @brief Repaints everything when the window is shown or uncovered
+ */
+void LiteWindow::exposeEvent(QExposeEvent *)
+{
+    if (isExposed()) {
+        update();
+        render();
+    }
+}
+
+/**
+ * @brief Draws the damaged part of the window; subclasses do the actual drawing
+ * @param event Describes the region that needs to be redrawn
+ */
+void LiteWindow::paintEvent(QPaintEvent *)
+{
+}
+
+/**
+ * @brief Gets what to paint on; only valid inside paintEvent()
+ * @return The backing store's paint device
+ */
+QPaintDevice *LiteWindow::paintDevice()
+{
+    return _backingStore->paintDevice();
+}
+
+/**
+ * @brief Paints and flushes whatever has been damaged since last time
+ */
+void LiteWindow::render()
+{
+    if (!isExposed() || _dirty.isEmpty()) {
+        return;
+    }
+
+    // The backing store keeps its contents between frames, so only a resize
+    // means starting over
+    if (_backingStore->size() != size()) {
+        _backingStore->resize(size());
+        _dirty = QRect(QPoint(), size());
+    }
+
+    QRegion const region = _dirty;
+    _dirty = QRegion();
+    _backingStore->beginPaint(region);
+    QPaintEvent paint(region);
+    paintEvent(&paint);
+    {
+        QPainter p(_backingStore->paintDevice());
+        p.setClipRegion(region);
+        for (GlyphLabel const *label : _labels) {
+            if (region.intersects(label->geometry())) {
+                label->paint(p);
+            }
+        }
+    }
+    _backingStore->endPaint();
+    _backingStore->flush(region);
+}
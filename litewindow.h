@@ -0,0 +1,67 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LITEWINDOW_H
+#define LITEWINDOW_H
+
+#include <QList>
+#include <QRegion>
+#include <QWindow>
+
+class GlyphLabel;
+class QBackingStore;
+class QPaintDevice;
+class QPaintEvent;
+
+/**
+ * @brief A bare raster window for the lite build, standing in for QMainWindow
+ *
+ * It only offers the handful of QWidget calls the calibration window uses:
+ * update() collects damage, and the next update request paints just that
+ * region into a QBackingStore through paintEvent(), the same way a widget
+ * would be. GlyphLabels are drawn on top afterwards, like child widgets.
+ */
+class LiteWindow : public QWindow
+{
+    Q_OBJECT
+
+public:
+    LiteWindow(QWindow *parent = nullptr);
+    ~LiteWindow();
+
+    void update();
+    void update(QRect const &rect);
+    void update(QRegion const &region);
+    void addLabel(GlyphLabel *label);
+    void removeLabel(GlyphLabel *label);
+
+protected:
+    bool event(QEvent *event);
+    void exposeEvent(QExposeEvent *event);
+    virtual void paintEvent(QPaintEvent *event);
+    QPaintDevice *paintDevice();
+
+private:
+    void render();
+
+    QBackingStore *_backingStore;
+    QRegion _dirty;
+    QList<GlyphLabel *> _labels;
+};
+
+#endif // LITEWINDOW_H
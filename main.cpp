@@ -17,22 +17,454 @@
  */
 
 #include "calibrationwindow.h"
+#include "calibrationsession.h"
 #include "calibrationutils.h"
+#include "driftdaemon.h"
+#include "replay.h"
+#include "startupprofile.h"
+#include "telemetry.h"
+#include "uinputfilter.h"
 
+#include <QCommandLineParser>
+#ifdef CHUMBY8TSCAL_LITE
+#include <QGuiApplication>
+#include <QScreen>
+#else
 #include <QApplication>
 #include <QDesktopWidget>
+#endif
 #include <cstring>
 #include <cstdlib>
+#include <unistd.h>
+
+/**
+ * @brief Applies saved calibration records, each to the touchscreen it was made for
+ * @param records The records from the record file
+ * @return True if every touchscreen that's there now got its calibration
+ *
+ * A record is only used if the touchscreen still reports the ranges it was
+ * calibrated with. A panel whose driver or firmware has changed them needs the
+ * config file or a new calibration instead.
+ */
+static bool applySavedRecords(QVector<CalibrationRecord> const &records)
+{
+    // Figure out which node each touchscreen is on this time
+    QVector<int> fds;
+    QStringList paths;
+    if (!CalibrationUtils::findTouchScreens(false, fds, paths)) {
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < fds.length(); i++) {
+        TouchIdentity identity;
+        TouchAxes axes;
+        CalibrationUtils::readDeviceIdentity(fds[i], identity);
+        bool const haveAxes = CalibrationUtils::readTouchAxes(fds[i], axes);
+        ::close(fds[i]);
+
+        int const record = CalibrationRecordFile::find(records, identity);
+        if (record < 0) {
+            qCritical("No saved calibration record for touchscreen %s", identity.key().constData());
+            ok = false;
+            continue;
+        }
+
+        CalibrationRecord const &saved = records[record];
+        if (!haveAxes || axes.x.minimum != saved.xMinimum || axes.x.maximum != saved.xMaximum ||
+            axes.y.minimum != saved.yMinimum || axes.y.maximum != saved.yMaximum) {
+            qCritical("Touchscreen %s doesn't have the ranges it was calibrated with", identity.key().constData());
+            ok = false;
+            continue;
+        }
+
+        // With just one touchscreen, whichever one X has is it
+        CalibrationSession session(fds.length() > 1 ? paths[i] : QString());
+        if (!session.apply(saved)) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Pushes the saved calibration to X without bringing up any GUI
+ * @return The process exit code
+ */
+static int applySavedCalibration()
+{
+    // The binary records are quickest, but they're only a copy; the config file is the real thing
+    QVector<CalibrationRecord> records;
+    if (CalibrationUtils::loadCalibrationRecords(records)) {
+        if (applySavedRecords(records)) {
+            return EXIT_SUCCESS;
+        }
+        qCritical("Unable to apply saved calibration records, trying the config file");
+    }
+
+    QList<DeviceCalibration> calibrations;
+    if (!CalibrationUtils::loadSavedCalibration(calibrations)) {
+        return EXIT_FAILURE;
+    }
+
+    // The config file only knows which node each matrix was for when it was saved
+    bool ok = true;
+    for (DeviceCalibration const &calibration : calibrations) {
+        CalibrationSession session(calibration.path);
+        if (!session.apply(calibration.matrix)) {
+            qCritical("Unable to apply saved calibration");
+            ok = false;
+        }
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Copies the matrix out of a calibration record
+ * @param record The record
+ * @return The 3x3 calibration matrix (9 floats)
+ */
+static QVector<float> recordMatrix(CalibrationRecord const &record)
+{
+    QVector<float> matrix;
+    for (int i = 0; i < 9; i++) {
+        matrix.append(record.matrix[i]);
+    }
+    return matrix;
+}
+
+/**
+ * @brief Saves the current calibration as a profile that other units can import
+ * @param path The profile file to write
+ * @param batch True to leave out the panels' unique IDs, so the profile fits any panel of the same kind
+ * @return The process exit code
+ */
+static int exportProfile(QString const &path, bool batch)
+{
+    // The records already know which touchscreen each calibration was made for
+    QVector<CalibrationRecord> records;
+    if (!CalibrationUtils::loadCalibrationRecords(records)) {
+        qCritical("No saved calibration record to export; calibrate this unit first");
+        return EXIT_FAILURE;
+    }
+
+    QByteArray profile;
+    for (CalibrationRecord const &record : records) {
+        TouchAxes axes;
+        axes.x.minimum = record.xMinimum;
+        axes.x.maximum = record.xMaximum;
+        axes.y.minimum = record.yMinimum;
+        axes.y.maximum = record.yMaximum;
+        TouchIdentity identity;
+        identity.id.bustype = record.busType;
+        identity.id.vendor = record.vendor;
+        identity.id.product = record.product;
+        identity.id.version = record.deviceVersion;
+        memcpy(identity.phys, record.phys, sizeof(identity.phys));
+        if (!batch) {
+            memcpy(identity.uniq, record.uniq, sizeof(identity.uniq));
+        }
+        profile += CalibrationRecordFile::build(recordMatrix(record), axes, identity);
+    }
+
+    if (!CalibrationUtils::writeFileAtomically(path, profile)) {
+        qCritical("Unable to write calibration profile %s", path.toUtf8().constData());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Applies the calibration from a profile to every touchscreen that's connected
+ * @param path The profile file
+ * @param calibrations Filled in with what was applied to each touchscreen
+ * @return True if every touchscreen had a calibration in the profile and it was applied
+ *
+ * Nothing is saved here, so that the result can be checked first.
+ */
+static bool importProfile(QString const &path, QList<DeviceCalibration> &calibrations)
+{
+    QVector<CalibrationRecord> records;
+    if (!CalibrationRecordFile::load(path.toUtf8().constData(), records, MAX_PROFILE_RECORDS)) {
+        return false;
+    }
+
+    QVector<int> fds;
+    QStringList paths;
+    if (!CalibrationUtils::findTouchScreens(false, fds, paths)) {
+        return false;
+    }
+
+    // Work out which profile record goes with each touchscreen. The matrix is
+    // relative to the raw ranges, so it carries over to this unit's ranges as is.
+    calibrations.clear();
+    bool ok = true;
+    for (int i = 0; i < fds.length(); i++) {
+        DeviceCalibration calibration;
+        calibration.path = paths[i];
+        CalibrationUtils::readDeviceIdentity(fds[i], calibration.identity);
+        if (!CalibrationUtils::readTouchAxes(fds[i], calibration.axes)) {
+            ok = false;
+        }
+        ::close(fds[i]);
+
+        int const record = CalibrationRecordFile::find(records, calibration.identity);
+        if (record < 0) {
+            qCritical("No calibration in the profile for touchscreen %s", calibration.identity.key().constData());
+            ok = false;
+            continue;
+        }
+        calibration.matrix = recordMatrix(records[record]);
+        calibrations.append(calibration);
+    }
+    if (!ok) {
+        return false;
+    }
+
+    // With just one touchscreen, whichever one X has is it
+    for (DeviceCalibration const &calibration : calibrations) {
+        CalibrationSession session(calibrations.length() > 1 ? calibration.path : QString());
+        if (!session.apply(calibration.matrix)) {
+            qCritical("Unable to apply imported calibration");
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the pressure gate settings from the command line
+ * @param minPressure The --min-pressure value
+ * @param settleFrames The --settle-frames value
+ * @param gate Filled in with the settings
+ * @return True on success, false if either value isn't a number of zero or more
+ */
+static bool parsePressureGate(QString const &minPressure, QString const &settleFrames, PressureGate &gate)
+{
+    bool ok;
+    gate.minPressure = minPressure.toInt(&ok);
+    if (!ok || gate.minPressure < 0) {
+        qCritical("The minimum pressure must be a number of 0 or more");
+        return false;
+    }
+    gate.settleFrames = settleFrames.toInt(&ok);
+    if (!ok || gate.settleFrames < 0) {
+        qCritical("The number of settle frames must be a number of 0 or more");
+        return false;
+    }
+    return true;
+}
 
 int main(int argc, char *argv[])
 {
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Calibrates the Chumby 8 touchscreen.");
+    parser.addHelpOption();
+    QCommandLineOption inputThreadOption("input-thread",
+        "Read the touchscreen on a dedicated thread instead of the GUI thread.");
+    parser.addOption(inputThreadOption);
+    QCommandLineOption fullScanOption("full-scan",
+        "Find the touchscreen by opening every input device instead of using sysfs.");
+    parser.addOption(fullScanOption);
+    QCommandLineOption exclusiveOption("exclusive",
+        "Grab the touchscreen while calibrating so X doesn't also move the pointer and click.");
+    parser.addOption(exclusiveOption);
+    QCommandLineOption pointsOption("points",
+        "Number of calibration points: 4 (scale and offset only), or 5 or 9 for a full "
+        "affine calibration that also corrects rotation and skew.", "count",
+        QString::number(DEFAULT_CAL_POINTS));
+    parser.addOption(pointsOption);
+    QCommandLineOption minPressureOption("min-pressure",
+        "Ignore touch samples lighter than this raw pressure, if the touchscreen reports pressure.",
+        "pressure", "0");
+    parser.addOption(minPressureOption);
+    QCommandLineOption settleOption("settle-frames",
+        "Ignore this many samples at the start of each tap, while the touch is settling.", "count", "2");
+    parser.addOption(settleOption);
+    QCommandLineOption verifyOption("verify",
+        "After calibrating, draw calibrated touches on the screen to check the result before saving.");
+    parser.addOption(verifyOption);
+    QCommandLineOption applySavedOption("apply-saved",
+        "Apply the saved calibration to X and exit without showing anything.");
+    parser.addOption(applySavedOption);
+    QCommandLineOption exportOption("export-profile",
+        "Save the current calibration as a profile for importing on other units, and exit.", "file");
+    parser.addOption(exportOption);
+    QCommandLineOption batchOption("batch",
+        "With --export-profile, leave out the panel's serial number so the profile fits any panel of its kind.");
+    parser.addOption(batchOption);
+    QCommandLineOption importOption("import-profile",
+        "Apply and save the calibration from a profile instead of tapping crosshairs.", "file");
+    parser.addOption(importOption);
+    QCommandLineOption tapCheckOption("tap-check",
+        "With --import-profile, only save it if a single tap on a crosshair lands within this many pixels.",
+        "pixels");
+    parser.addOption(tapCheckOption);
+    QCommandLineOption scriptOption("script",
+        "Let a test fixture do the tapping: report targets and results on stdout, take commands on stdin, "
+        "and save without a confirming tap.");
+    parser.addOption(scriptOption);
+    QCommandLineOption driftOption("drift-daemon",
+        "Run in the background, refining the calibration from taps on targets that clients report.");
+    parser.addOption(driftOption);
+    QCommandLineOption driftSocketOption("drift-socket",
+        "Socket that --drift-daemon receives targets on.", "path", DRIFT_SOCKET_PATH);
+    parser.addOption(driftSocketOption);
+    QCommandLineOption driftThresholdOption("drift-threshold",
+        "Only apply a drift correction once it moves a touch by at least this many pixels.", "pixels", "2");
+    parser.addOption(driftThresholdOption);
+    QCommandLineOption uinputOption("uinput-filter",
+        "Take over the touchscreens and pass calibrated touches on through a virtual touchscreen.");
+    parser.addOption(uinputOption);
+    QCommandLineOption recordOption("record",
+        "Save every raw touchscreen event to a capture file while calibrating.", "file");
+    parser.addOption(recordOption);
+    QCommandLineOption replayOption("replay",
+        "Run a capture file through the calibration without a screen and print the results.", "file");
+    parser.addOption(replayOption);
+    QCommandLineOption benchmarkOption("benchmark",
+        "Measure decoder and calibration throughput and latency using a capture file.", "file");
+    parser.addOption(benchmarkOption);
+    QCommandLineOption iterationsOption("iterations",
+        "Number of passes through the capture file for --benchmark.", "count", "1000");
+    parser.addOption(iterationsOption);
+    QCommandLineOption telemetryOption("telemetry",
+        "Append a telemetry record for each touchscreen to this file when the program exits.", "file");
+    parser.addOption(telemetryOption);
+    QCommandLineOption telemetryLimitOption("telemetry-limit",
+        "Size (in KiB) the telemetry file can grow to before it's moved aside to <file>.1.", "KiB",
+        QString::number(TELEMETRY_DEFAULT_LIMIT / 1024));
+    parser.addOption(telemetryLimitOption);
+    QCommandLineOption dumpTelemetryOption("dump-telemetry",
+        "Print the records in a telemetry file (and its .1) as CSV.", "file");
+    parser.addOption(dumpTelemetryOption);
+    QCommandLineOption profileStartupOption("profile-startup",
+        "Print how long each step of startup took, up to the first frame.");
+    parser.addOption(profileStartupOption);
+
+    // Some modes don't need a screen, so look for them before QApplication gets a
+    // chance to load the platform plugin, fonts and styles. Parse errors and
+    // --help are dealt with by QApplication below.
+    QStringList arguments;
+    for (int i = 0; i < argc; i++) {
+        arguments << QString::fromLocal8Bit(argv[i]);
+    }
+    PressureGate gate;
+    float tapTolerance = 0;
+    if (parser.parse(arguments)) {
+        if (parser.isSet(profileStartupOption)) {
+            StartupProfile::enable();
+        }
+        if (!parsePressureGate(parser.value(minPressureOption), parser.value(settleOption), gate)) {
+            return EXIT_FAILURE;
+        }
+        if (parser.isSet(tapCheckOption)) {
+            if (!parser.isSet(importOption)) {
+                qCritical("--tap-check only works with --import-profile");
+                return EXIT_FAILURE;
+            }
+            bool ok;
+            tapTolerance = parser.value(tapCheckOption).toFloat(&ok);
+            if (!ok || tapTolerance <= 0) {
+                qCritical("The tap check tolerance must be a number of pixels more than 0");
+                return EXIT_FAILURE;
+            }
+        }
+        if (parser.isSet(applySavedOption)) {
+            return applySavedCalibration();
+        }
+        if (parser.isSet(driftOption)) {
+            bool ok;
+            float const threshold = parser.value(driftThresholdOption).toFloat(&ok);
+            if (!ok || threshold <= 0) {
+                qCritical("The drift threshold must be a number of pixels more than 0");
+                return EXIT_FAILURE;
+            }
+            DriftDaemon daemon(parser.value(driftSocketOption), threshold, gate);
+            return daemon.run();
+        }
+        if (parser.isSet(uinputOption)) {
+            UinputFilter filter(gate);
+            return filter.run();
+        }
+        if (parser.isSet(exportOption)) {
+            return exportProfile(parser.value(exportOption), parser.isSet(batchOption));
+        }
+        if (parser.isSet(importOption) && !parser.isSet(tapCheckOption)) {
+            QList<DeviceCalibration> calibrations;
+            if (!importProfile(parser.value(importOption), calibrations) ||
+                !CalibrationUtils::saveNewCalibration(calibrations)) {
+                return EXIT_FAILURE;
+            }
+            return EXIT_SUCCESS;
+        }
+        if (parser.isSet(replayOption)) {
+            return Replay::run(parser.value(replayOption), gate);
+        }
+        if (parser.isSet(benchmarkOption)) {
+            return Replay::benchmark(parser.value(benchmarkOption), parser.value(iterationsOption).toInt(), gate);
+        }
+        if (parser.isSet(dumpTelemetryOption)) {
+            return Telemetry::dump(parser.value(dumpTelemetryOption));
+        }
+    }
+
     // Now load up the screen to do the calibration process
+#ifdef CHUMBY8TSCAL_LITE
+    QGuiApplication a(argc, argv);
+#else
     QApplication a(argc, argv);
-    CalibrationWindow w;
+#endif
+    StartupProfile::mark(StartupProfile::ApplicationCreated);
+    parser.process(a);
+
+    CalibrationOptions options;
+    options.inputThread = parser.isSet(inputThreadOption);
+    options.fullScan = parser.isSet(fullScanOption);
+    options.exclusive = parser.isSet(exclusiveOption);
+    options.calibrationPoints = parser.value(pointsOption).toInt();
+    if (options.calibrationPoints != 4 && options.calibrationPoints != 5 &&
+        options.calibrationPoints != 9) {
+        qCritical("The number of calibration points must be 4, 5 or 9");
+        return EXIT_FAILURE;
+    }
+    options.recordFile = parser.value(recordOption);
+    options.verify = parser.isSet(verifyOption);
+    options.scripted = parser.isSet(scriptOption);
+    if (options.scripted && (options.verify || parser.isSet(importOption))) {
+        qCritical("--script can't be combined with --verify or --import-profile");
+        return EXIT_FAILURE;
+    }
+    // QApplication only gets this far with the same arguments that were parsed above
+    options.pressureGate = gate;
+    options.telemetryFile = parser.value(telemetryOption);
+    options.telemetryLimit = parser.value(telemetryLimitOption).toLongLong() * 1024;
+    if (options.telemetryLimit < static_cast<qint64>(sizeof(TelemetryRecord))) {
+        qCritical("The telemetry limit is too small to hold a single record");
+        return EXIT_FAILURE;
+    }
+    if (parser.isSet(importOption)) {
+        // The profile is already live by the time the crosshair shows up, so the tap checks what X will do
+        options.tapTolerance = tapTolerance;
+        if (!importProfile(parser.value(importOption), options.profile)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    StartupProfile::mark(StartupProfile::OptionsParsed);
+
+    CalibrationWindow w(options);
     w.showFullScreen();
+    StartupProfile::mark(StartupProfile::WindowShown);
     // If there isn't a window manager running, showFullScreen() doesn't resize
     // the window to full-screen properly. So make sure we're the correct size,
     // even if there isn't a window manager running.
+#ifdef CHUMBY8TSCAL_LITE
+    w.setGeometry(a.primaryScreen()->geometry());
+#else
     w.setGeometry(0, 0, a.desktop()->size().width(), a.desktop()->size().height());
+#endif
+    StartupProfile::mark(StartupProfile::GeometrySet);
     return a.exec();
 }
@@ -0,0 +1,77 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "processstats.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+/// Field of /proc/self/stat holding the start time, counting from 1
+#define PROC_STAT_START_TIME_FIELD      22
+
+/**
+ * @brief Figures out how long ago the process started
+ * @return The time in seconds, or -1 if it can't be determined
+ *
+ * The kernel only keeps the start time in clock ticks (usually 10 ms), so
+ * that's as precise as this gets.
+ */
+double ProcessStats::secondsSinceStart()
+{
+    FILE *f = fopen("/proc/self/stat", "re");
+    if (!f) {
+        return -1;
+    }
+    char buffer[512];
+    size_t const length = fread(buffer, 1, sizeof(buffer) - 1, f);
+    fclose(f);
+    buffer[length] = 0;
+
+    // The command name can contain spaces and parentheses, so start counting
+    // fields after the last closing parenthesis, which ends field 2
+    char const *field = strrchr(buffer, ')');
+    int number = 2;
+    while (field && number < PROC_STAT_START_TIME_FIELD) {
+        field = strchr(field + 1, ' ');
+        number++;
+    }
+    unsigned long long startTicks;
+    if (!field || sscanf(field, " %llu", &startTicks) != 1) {
+        return -1;
+    }
+
+    // The start time counts from boot, including any time spent suspended
+    timespec now;
+    clock_gettime(CLOCK_BOOTTIME, &now);
+    return now.tv_sec + now.tv_nsec / 1e9 - static_cast<double>(startTicks) / sysconf(_SC_CLK_TCK);
+}
+
+/**
+ * @brief Gets the most memory the process has had resident at once
+ * @return The peak resident set size in kilobytes
+ */
+long ProcessStats::peakResidentKilobytes()
+{
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) < 0) {
+        return -1;
+    }
+    return usage.ru_maxrss;
+}
@@ -0,0 +1,36 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROCESSSTATS_H
+#define PROCESSSTATS_H
+
+/**
+ * @brief Startup time and memory use of the whole process, for comparing builds
+ *
+ * The startup time is counted from when the kernel created the process, so it
+ * includes loading and relocating the Qt libraries before main() runs, which
+ * is where most of the difference between the normal and lite builds is.
+ */
+class ProcessStats
+{
+public:
+    static double secondsSinceStart();
+    static long peakResidentKilobytes();
+};
+
+#endif // PROCESSSTATS_H
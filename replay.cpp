@@ -0,0 +1,244 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "replay.h"
+#include "calibrator.h"
+#include "calibrationtransform.h"
+#include "capturefile.h"
+#include "eventreader.h"
+#include "touchdecoder.h"
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+/**
+ * @brief Reads the monotonic clock
+ * @return The current time in nanoseconds
+ */
+static qint64 monotonicNanoseconds()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<qint64>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief Replays a capture file and prints what the calibration would have come up with
+ * @param path The capture file
+ * @param gate Which samples of each touch to calibrate with
+ * @return The process exit code: success only if the calibration succeeded
+ */
+int Replay::run(QString const &path, PressureGate const &gate)
+{
+    CaptureReader reader;
+    if (!reader.open(path)) {
+        return EXIT_FAILURE;
+    }
+
+    TouchDecoder decoder;
+    Calibrator calibrator(reader.calibrationPoints(), reader.screenSize());
+    calibrator.setAxes(reader.axes());
+    calibrator.setPressureGate(gate);
+    Calibrator::Result outcome = Calibrator::NoChange;
+    input_event events[EVENT_BATCH_SIZE];
+    int count;
+    unsigned long totalEvents = 0;
+    unsigned long totalFrames = 0;
+
+    printf("Replaying %d-point calibration on a %dx%d screen, raw X %d-%d, Y %d-%d\n",
+           reader.calibrationPoints(), reader.screenSize().width(), reader.screenSize().height(),
+           reader.axes().x.minimum, reader.axes().x.maximum, reader.axes().y.minimum, reader.axes().y.maximum);
+
+    while ((count = reader.read(events, EVENT_BATCH_SIZE)) > 0) {
+        totalEvents += static_cast<unsigned long>(count);
+        for (int i = 0; i < count; i++) {
+            if (!decoder.processEvent(events[i])) {
+                continue;
+            }
+            totalFrames++;
+
+            TouchSample const &sample = decoder.sample();
+            Calibrator::Result const result = calibrator.handleTouchUpdate(sample);
+            if (result == Calibrator::PointCaptured || result == Calibrator::CalibrationSucceeded ||
+                result == Calibrator::CalibrationFailed) {
+                int const point = calibrator.samples().length() - 1;
+                QPoint const &raw = calibrator.samples().at(point);
+                QPoint const &target = calibrator.targets().at(point);
+                printf("Point %d at (%d, %d): raw (%d, %d)\n", point, target.x(), target.y(), raw.x(), raw.y());
+            }
+            if (result == Calibrator::CalibrationSucceeded || result == Calibrator::CalibrationFailed) {
+                outcome = result;
+            }
+        }
+    }
+
+    printf("%lu events, %lu frames\n", totalEvents, totalFrames);
+    if (calibrator.gatedSamples() > 0) {
+        printf("%lu samples ignored by the pressure gate\n", calibrator.gatedSamples());
+    }
+    decoder.logStatistics();
+
+    if (outcome != Calibrator::CalibrationSucceeded) {
+        printf("Calibration %s\n", outcome == Calibrator::CalibrationFailed ? "failed" : "incomplete");
+        return EXIT_FAILURE;
+    }
+
+    QVector<float> const &m = calibrator.matrix();
+    printf("Matrix: %f %f %f %f %f %f %f %f %f\n", m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+    for (int i = 0; i < calibrator.targets().length(); i++) {
+        printf("Point %d error: %.2f pixels\n", i, static_cast<double>(calibrator.residual(i)));
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Measures how fast the decoder and calibration math chew through a capture file
+ * @param path The capture file
+ * @param iterations How many times to run through the whole capture
+ * @param gate Which samples of each touch to calibrate with
+ * @return The process exit code
+ */
+int Replay::benchmark(QString const &path, int iterations, PressureGate const &gate)
+{
+    CaptureReader reader;
+    if (!reader.open(path)) {
+        return EXIT_FAILURE;
+    }
+
+    // Load everything up front so file I/O doesn't end up in the measurements
+    QVector<input_event> const events = reader.readAll();
+    if (events.isEmpty() || iterations < 1) {
+        qCritical("Nothing to benchmark");
+        return EXIT_FAILURE;
+    }
+    int const numPoints = reader.calibrationPoints();
+    QSize const screenSize = reader.screenSize();
+    TouchAxes const axes = reader.axes();
+
+    // Throughput: run the whole capture through as fast as possible
+    unsigned long frames = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        TouchDecoder decoder;
+        Calibrator calibrator(numPoints, screenSize);
+        calibrator.setAxes(axes);
+        calibrator.setPressureGate(gate);
+        for (input_event const &event : events) {
+            if (decoder.processEvent(event)) {
+                TouchSample const &sample = decoder.sample();
+                calibrator.handleTouchUpdate(sample);
+                frames++;
+            }
+        }
+    }
+    qint64 const elapsed = qMax(timer.nsecsElapsed(), static_cast<qint64>(1));
+    double const totalEvents = static_cast<double>(events.length()) * iterations;
+
+    printf("%d iterations of %d events (%lu frames) in %.3f ms\n", iterations, events.length(),
+           frames, elapsed / 1e6);
+    printf("Throughput: %.0f events/sec, %.0f frames/sec\n",
+           totalEvents * 1e9 / elapsed, frames * 1e9 / elapsed);
+
+    // Latency: time each frame from its first event through the calibration
+    // update. Done as a separate pass so the clock reads don't skew the throughput.
+    QVector<qint64> frameTimes;
+    frameTimes.reserve(static_cast<int>(frames / static_cast<unsigned long>(iterations)) + 1);
+    TouchDecoder decoder;
+    Calibrator calibrator(numPoints, screenSize);
+    calibrator.setAxes(axes);
+    calibrator.setPressureGate(gate);
+    qint64 frameStart = -1;
+    for (input_event const &event : events) {
+        if (frameStart < 0) {
+            frameStart = monotonicNanoseconds();
+        }
+        if (decoder.processEvent(event)) {
+            TouchSample const &sample = decoder.sample();
+            calibrator.handleTouchUpdate(sample);
+            frameTimes.append(monotonicNanoseconds() - frameStart);
+            frameStart = -1;
+        }
+    }
+
+    if (!frameTimes.isEmpty()) {
+        std::sort(frameTimes.begin(), frameTimes.end());
+        qint64 sum = 0;
+        for (qint64 t : frameTimes) {
+            sum += t;
+        }
+        int const n = frameTimes.length();
+        printf("Per-frame decode latency (ns): min %lld, median %lld, p99 %lld, max %lld, mean %.1f\n",
+               static_cast<long long>(frameTimes.first()),
+               static_cast<long long>(frameTimes[n / 2]),
+               static_cast<long long>(frameTimes[qMin(n - 1, (n * 99) / 100)]),
+               static_cast<long long>(frameTimes.last()),
+               static_cast<double>(sum) / n);
+    }
+
+    // Transform throughput: push every touched sample in the capture through each
+    // version of the matrix kernel, using the matrix the capture calibrated to
+    QVector<int> rawX, rawY;
+    TouchDecoder sampleDecoder;
+    for (input_event const &event : events) {
+        if (sampleDecoder.processEvent(event) && sampleDecoder.sample().pressed) {
+            rawX.append(sampleDecoder.sample().xy.x());
+            rawY.append(sampleDecoder.sample().xy.y());
+        }
+    }
+    if (!rawX.isEmpty() && calibrator.matrix().length() == 9) {
+        CalibrationTransform const transform(calibrator.matrix().constData(), axes, screenSize);
+        int const count = rawX.length();
+        QVector<float> screenX(count), screenY(count);
+        QVector<qint32> fixedX(count), fixedY(count);
+
+        timer.start();
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            transform.transform(rawX.constData(), rawY.constData(), count, screenX.data(), screenY.data());
+        }
+        qint64 const simdTime = qMax(timer.nsecsElapsed(), static_cast<qint64>(1));
+
+        timer.start();
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            transform.transformScalar(rawX.constData(), rawY.constData(), count, screenX.data(), screenY.data());
+        }
+        qint64 const scalarTime = qMax(timer.nsecsElapsed(), static_cast<qint64>(1));
+
+        timer.start();
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            transform.transformFixed(rawX.constData(), rawY.constData(), count, fixedX.data(), fixedY.data());
+        }
+        qint64 const fixedTime = qMax(timer.nsecsElapsed(), static_cast<qint64>(1));
+
+        // How far the fixed-point results stray from floating point
+        double maxError = 0;
+        for (int i = 0; i < count; i++) {
+            maxError = qMax(maxError, qAbs(fixedX[i] / 65536.0 - screenX[i]));
+            maxError = qMax(maxError, qAbs(fixedY[i] / 65536.0 - screenY[i]));
+        }
+
+        double const totalSamples = static_cast<double>(count) * iterations;
+        printf("Transform of %d samples: %.1f M/sec (%s), %.1f M/sec (scalar), %.1f M/sec (Q16, max error %.4f pixels)\n",
+               count, totalSamples * 1e3 / simdTime, CalibrationTransform::simdName(),
+               totalSamples * 1e3 / scalarTime, totalSamples * 1e3 / fixedTime, maxError);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <QString>
+#include "calibrator.h"
+
+/**
+ * @brief Runs recorded touchscreen captures through the decoder and calibration math
+ *
+ * Neither of these needs X, a screen, or a touchscreen, so they work on a PC
+ * as well as on the Chumby.
+ */
+class Replay
+{
+public:
+    static int run(QString const &path, PressureGate const &gate);
+    static int benchmark(QString const &path, int iterations, PressureGate const &gate);
+};
+
+#endif // REPLAY_H
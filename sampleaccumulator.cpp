@@ -0,0 +1,158 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sampleaccumulator.h"
+#include <cmath>
+
+/**
+ * @brief Sorts a small array in place
+ * @param values The array
+ * @param count The number of elements
+ */
+static void sortSmall(int *values, int count)
+{
+    // Insertion sort; there are never more than SAMPLE_WINDOW_SIZE values
+    for (int i = 1; i < count; i++) {
+        int const v = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > v) {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = v;
+    }
+}
+
+/**
+ * @brief Averages the middle of a sorted array, ignoring the top and bottom quarter
+ * @param values The sorted array
+ * @param count The number of elements (at least 1)
+ * @return The trimmed mean, rounded to the nearest integer
+ */
+static int trimmedMean(int const *values, int count)
+{
+    int const trim = count / 4;
+    int sum = 0;
+    for (int i = trim; i < count - trim; i++) {
+        sum += values[i];
+    }
+    return qRound(static_cast<float>(sum) / static_cast<float>(count - 2 * trim));
+}
+
+/**
+ * @brief Constructor for SampleAccumulator
+ */
+SampleAccumulator::SampleAccumulator()
+{
+    reset();
+}
+
+/**
+ * @brief Throws out all of the samples, ready for the next calibration point
+ */
+void SampleAccumulator::reset()
+{
+    _next = 0;
+    _count = 0;
+    _sumX = 0;
+    _sumY = 0;
+    _sumSqX = 0;
+    _sumSqY = 0;
+}
+
+/**
+ * @brief Adds a sample, pushing out the oldest one if the window is full
+ * @param sample The raw touch location
+ */
+void SampleAccumulator::add(QPoint const &sample)
+{
+    if (_count == SAMPLE_WINDOW_SIZE) {
+        QPoint const &oldest = _samples[_next];
+        _sumX -= oldest.x();
+        _sumY -= oldest.y();
+        _sumSqX -= static_cast<qint64>(oldest.x()) * oldest.x();
+        _sumSqY -= static_cast<qint64>(oldest.y()) * oldest.y();
+    } else {
+        _count++;
+    }
+
+    _samples[_next] = sample;
+    _sumX += sample.x();
+    _sumY += sample.y();
+    _sumSqX += static_cast<qint64>(sample.x()) * sample.x();
+    _sumSqY += static_cast<qint64>(sample.y()) * sample.y();
+    _next = (_next + 1) % SAMPLE_WINDOW_SIZE;
+}
+
+/**
+ * @brief Determines whether the touch has settled down enough to use
+ * @param maxStdDevX The largest standard deviation allowed on the X axis, in raw units
+ * @param maxStdDevY The largest standard deviation allowed on the Y axis, in raw units
+ * @return True if the window is full and neither axis varies by more than allowed
+ */
+bool SampleAccumulator::isStable(float maxStdDevX, float maxStdDevY) const
+{
+    if (_count < SAMPLE_WINDOW_SIZE) {
+        return false;
+    }
+
+    // n^2 * variance = n * sum(x^2) - sum(x)^2, which stays in integers
+    double const n = _count;
+    double const limitX = static_cast<double>(maxStdDevX) * maxStdDevX * n * n;
+    double const limitY = static_cast<double>(maxStdDevY) * maxStdDevY * n * n;
+    return static_cast<double>(_count * _sumSqX - _sumX * _sumX) <= limitX &&
+           static_cast<double>(_count * _sumSqY - _sumY * _sumY) <= limitY;
+}
+
+/**
+ * @brief Calculates how much the samples in the window are spread out
+ * @param x Filled in with the standard deviation of the X samples
+ * @param y Filled in with the standard deviation of the Y samples
+ */
+void SampleAccumulator::stdDev(float &x, float &y) const
+{
+    if (_count == 0) {
+        x = y = 0;
+        return;
+    }
+
+    double const n = _count;
+    x = static_cast<float>(std::sqrt(qMax(0.0, static_cast<double>(_count * _sumSqX - _sumX * _sumX)) / (n * n)));
+    y = static_cast<float>(std::sqrt(qMax(0.0, static_cast<double>(_count * _sumSqY - _sumY * _sumY)) / (n * n)));
+}
+
+/**
+ * @brief Calculates the position of the touch from the samples in the window
+ * @return The trimmed mean of each axis, or (0, 0) if there are no samples
+ */
+QPoint SampleAccumulator::result() const
+{
+    if (_count == 0) {
+        return QPoint();
+    }
+
+    int xs[SAMPLE_WINDOW_SIZE];
+    int ys[SAMPLE_WINDOW_SIZE];
+    for (int i = 0; i < _count; i++) {
+        xs[i] = _samples[i].x();
+        ys[i] = _samples[i].y();
+    }
+    sortSmall(xs, _count);
+    sortSmall(ys, _count);
+    return QPoint(trimmedMean(xs, _count), trimmedMean(ys, _count));
+}
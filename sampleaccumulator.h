@@ -0,0 +1,59 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SAMPLEACCUMULATOR_H
+#define SAMPLEACCUMULATOR_H
+
+#include <QPoint>
+#include <QtGlobal>
+
+/// Number of most recent samples kept while a calibration point is being touched
+#define SAMPLE_WINDOW_SIZE              8
+
+/**
+ * @brief Collects the raw samples for one calibration point and decides when they've settled
+ *
+ * Only the last SAMPLE_WINDOW_SIZE samples are kept, in a fixed ring, and
+ * their sums and sums of squares are kept up to date as samples come and go,
+ * so checking the variance after each sample is cheap. The final position is
+ * a trimmed mean, which throws out the most extreme samples on each axis so
+ * a single glitch (usually at lift-off) doesn't drag the point off.
+ */
+class SampleAccumulator
+{
+public:
+    SampleAccumulator();
+
+    void reset();
+    void add(QPoint const &sample);
+    int count() const { return _count; }
+    bool isStable(float maxStdDevX, float maxStdDevY) const;
+    void stdDev(float &x, float &y) const;
+    QPoint result() const;
+
+private:
+    QPoint _samples[SAMPLE_WINDOW_SIZE];
+    int _next;
+    int _count;
+    qint64 _sumX;
+    qint64 _sumY;
+    qint64 _sumSqX;
+    qint64 _sumSqY;
+};
+
+#endif // SAMPLEACCUMULATOR_H
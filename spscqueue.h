@@ -0,0 +1,77 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+
+/**
+ * @brief Fixed-size lock-free queue for exactly one producer and one consumer thread
+ *
+ * The producer only ever writes _head and the consumer only ever writes _tail,
+ * so acquire/release ordering on those two indices is all the synchronization
+ * needed. The indices run freely and wrap; Size must be a power of two.
+ */
+template <typename T, unsigned int Size>
+class SpscQueue
+{
+    static_assert(Size != 0 && (Size & (Size - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    SpscQueue() : _head(0), _tail(0) {}
+
+    /**
+     * @brief Adds an item to the queue (producer thread only)
+     * @param item The item to copy into the queue
+     * @return True on success, false if the queue was full
+     */
+    bool push(T const &item)
+    {
+        unsigned int const head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) == Size) {
+            return false;
+        }
+        _items[head & (Size - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest item from the queue (consumer thread only)
+     * @param item Filled in with the removed item
+     * @return True on success, false if the queue was empty
+     */
+    bool pop(T &item)
+    {
+        unsigned int const tail = _tail.load(std::memory_order_relaxed);
+        if (_head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        item = _items[tail & (Size - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T _items[Size];
+    std::atomic<unsigned int> _head;
+    std::atomic<unsigned int> _tail;
+};
+
+#endif // SPSCQUEUE_H
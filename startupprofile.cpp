@@ -0,0 +1,108 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "startupprofile.h"
+#include "processstats.h"
+#include <QtGlobal>
+
+bool StartupProfile::_enabled = false;
+bool StartupProfile::_reached[NumMilestones];
+timespec StartupProfile::_times[NumMilestones];
+timespec StartupProfile::_enabledTime;
+double StartupProfile::_enabledSinceStart = -1;
+
+/// What each milestone is called in the breakdown
+static char const * const milestoneNames[StartupProfile::NumMilestones] = {
+    "arguments parsed",
+    "application created",
+    "options parsed",
+    "window created",
+    "touchscreens found",
+    "window constructed",
+    "window shown",
+    "geometry set",
+    "first paint started",
+    "first paint finished"
+};
+
+/**
+ * @brief Calculates the time between two readings of the monotonic clock
+ * @param start The earlier reading
+ * @param end The later reading
+ * @return The difference in milliseconds
+ */
+static double millisecondsBetween(timespec const &start, timespec const &end)
+{
+    return (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/**
+ * @brief Starts timing startup
+ *
+ * Called as soon as the command line has been parsed, which is also the first
+ * milestone.
+ */
+void StartupProfile::enable()
+{
+    _enabledSinceStart = ProcessStats::secondsSinceStart();
+    clock_gettime(CLOCK_MONOTONIC, &_enabledTime);
+    _enabled = true;
+    _reached[ArgumentsParsed] = true;
+    _times[ArgumentsParsed] = _enabledTime;
+}
+
+/**
+ * @brief Stamps a milestone the first time it's reached
+ * @param milestone The milestone
+ */
+void StartupProfile::record(Milestone milestone)
+{
+    if (!_reached[milestone]) {
+        clock_gettime(CLOCK_MONOTONIC, &_times[milestone]);
+        _reached[milestone] = true;
+    }
+}
+
+/**
+ * @brief Prints how long each step of startup took, if it's being timed
+ *
+ * Each step is the time since the previous milestone that was reached. It
+ * only prints once, so it can be called after every paint.
+ */
+void StartupProfile::logBreakdown()
+{
+    if (!_enabled) {
+        return;
+    }
+    _enabled = false;
+
+    // The first step runs from the process starting, which includes loading the libraries
+    double const beforeParsing = qMax(0.0, _enabledSinceStart * 1000);
+    qDebug("Startup profile (ms):        step    total");
+    timespec const *previous = &_enabledTime;
+    for (int i = 0; i < NumMilestones; i++) {
+        if (!_reached[i]) {
+            qDebug("  %-22s      not reached", milestoneNames[i]);
+            continue;
+        }
+        double const step = millisecondsBetween(*previous, _times[i]) + (i == ArgumentsParsed ? beforeParsing : 0);
+        double const total = millisecondsBetween(_enabledTime, _times[i]) + beforeParsing;
+        qDebug("  %-22s %8.2f %8.2f", milestoneNames[i], step, total);
+        previous = &_times[i];
+    }
+}
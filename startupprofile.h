@@ -0,0 +1,80 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STARTUPPROFILE_H
+#define STARTUPPROFILE_H
+
+#include <time.h>
+
+/**
+ * @brief Times each step of startup, from parsing the arguments to the first paint
+ *
+ * Each milestone is stamped with the monotonic clock as it's reached, and the
+ * breakdown is printed once the first frame has been painted. It's off unless
+ * enable() is called, and mark() is inline, so when it's off each milestone
+ * costs a single test of a flag.
+ *
+ * Times are counted from when the process started, so the first step includes
+ * loading and relocating the libraries before main(). That part comes from
+ * ProcessStats, so it's only as precise as the kernel's clock tick.
+ */
+class StartupProfile
+{
+public:
+    /// The points in startup that are timed, in the order they're reached
+    enum Milestone
+    {
+        /// Command line parsed, looking for the modes that don't need a screen
+        ArgumentsParsed,
+        /// QApplication (or QGuiApplication) constructed and connected to the display
+        ApplicationCreated,
+        /// Options checked, and an imported profile read
+        OptionsParsed,
+        /// The window's widget and members constructed, including the primary screen query
+        WindowCreated,
+        /// Every touchscreen found by findTouchScreens() opened and attached
+        TouchScreensFound,
+        /// CalibrationWindow's constructor finished
+        WindowConstructed,
+        /// showFullScreen() returned
+        WindowShown,
+        /// The window was manually resized to cover the screen
+        GeometrySet,
+        /// The first paintEvent() started
+        FirstPaintStarted,
+        /// The first paintEvent() finished
+        FirstPaintFinished,
+        /// Number of milestones; not a milestone itself
+        NumMilestones
+    };
+
+    static void enable();
+    static void mark(Milestone milestone) { if (_enabled) record(milestone); }
+    static void logBreakdown();
+
+private:
+    static void record(Milestone milestone);
+
+    static bool _enabled;
+    static bool _reached[NumMilestones];
+    static timespec _times[NumMilestones];
+    static timespec _enabledTime;
+    static double _enabledSinceStart;
+};
+
+#endif // STARTUPPROFILE_H
@@ -0,0 +1,373 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "telemetry.h"
+#include "calibrationrecord.h"
+#include <QFile>
+#include <cstdio>
+#include <cstdlib>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+/// Identifies a telemetry record
+#define TELEMETRY_MAGIC                 "C8TL"
+/// Current version of the telemetry record
+#define TELEMETRY_VERSION               1
+
+static_assert(sizeof(TelemetryPoint) == 32, "TelemetryPoint must not contain padding");
+static_assert(sizeof(TelemetryRecord) == 536, "TelemetryRecord must not contain padding");
+
+/// Names of the outcomes, for printing
+static char const * const outcomeNames[] = {
+    "ok",
+    "solve-failed",
+    "residual-too-large",
+    "out-of-range",
+    "incomplete"
+};
+
+/**
+ * @brief Squeezes a counter into 32 bits without wrapping around
+ * @param value The counter
+ * @return The value, or the largest 32-bit value if it's bigger
+ */
+static quint32 saturate32(unsigned long value)
+{
+    return value > 0xFFFFFFFFUL ? 0xFFFFFFFFU : static_cast<quint32>(value);
+}
+
+/**
+ * @brief Squeezes a count into 16 bits without wrapping around
+ * @param value The count
+ * @return The value, clamped to 0-65535
+ */
+static quint16 saturate16(long value)
+{
+    return static_cast<quint16>(qBound(0L, value, 0xFFFFL));
+}
+
+/**
+ * @brief Starts a telemetry record with the results of a calibration run
+ * @param record Filled in with the calibration half of the record; the input
+ *               statistics, latency and phase timings are left at zero
+ * @param identity The touchscreen that was calibrated
+ * @param calibrator The calibration, finished or not
+ */
+void Telemetry::describe(TelemetryRecord &record, TouchIdentity const &identity, Calibrator const &calibrator)
+{
+    memset(&record, 0, sizeof(record));
+    memcpy(record.magic, TELEMETRY_MAGIC, sizeof(record.magic));
+    record.version = TELEMETRY_VERSION;
+    record.size = sizeof(record);
+    record.time = static_cast<quint32>(::time(nullptr));
+
+    PointSpan const targets = calibrator.targets();
+    PointSpan const samples = calibrator.samples();
+    if (samples.length() < targets.length()) {
+        record.outcome = TelemetryIncomplete;
+    } else {
+        switch (calibrator.failure()) {
+        case Calibrator::NoFailure:
+            record.outcome = TelemetrySucceeded;
+            break;
+        case Calibrator::SolveFailed:
+            record.outcome = TelemetrySolveFailed;
+            break;
+        case Calibrator::ResidualTooLarge:
+            record.outcome = TelemetryResidualTooLarge;
+            break;
+        case Calibrator::OutOfRange:
+            record.outcome = TelemetryOutOfRange;
+            break;
+        }
+    }
+    if (calibrator.isAffine()) {
+        record.flags |= TelemetryAffine;
+    }
+    record.numPoints = static_cast<quint8>(targets.length());
+    record.capturedPoints = static_cast<quint8>(samples.length());
+
+    record.busType = identity.id.bustype;
+    record.vendor = identity.id.vendor;
+    record.product = identity.id.product;
+    record.deviceVersion = identity.id.version;
+    memcpy(record.phys, identity.phys, sizeof(record.phys));
+    memcpy(record.uniq, identity.uniq, sizeof(record.uniq));
+    record.phys[sizeof(record.phys) - 1] = 0;
+    record.uniq[sizeof(record.uniq) - 1] = 0;
+
+    record.screenWidth = saturate16(calibrator.screenSize().width());
+    record.screenHeight = saturate16(calibrator.screenSize().height());
+    record.xMinimum = calibrator.axes().x.minimum;
+    record.xMaximum = calibrator.axes().x.maximum;
+    record.yMinimum = calibrator.axes().y.minimum;
+    record.yMaximum = calibrator.axes().y.maximum;
+
+    // A failed calibration has no matrix, but the range check is still worth having
+    QVector<float> const &matrix = calibrator.matrix();
+    for (int i = 0; i < matrix.length() && i < 9; i++) {
+        record.matrix[i] = matrix[i];
+    }
+    record.maxResidual = calibrator.maxResidual();
+    record.minXCal = calibrator.minXCal();
+    record.maxXCal = calibrator.maxXCal();
+    record.minYCal = calibrator.minYCal();
+    record.maxYCal = calibrator.maxYCal();
+
+    for (int i = 0; i < targets.length(); i++) {
+        TelemetryPoint &point = record.points[i];
+        PointStats const &stats = calibrator.pointStats(i);
+        point.targetX = saturate16(targets[i].x());
+        point.targetY = saturate16(targets[i].y());
+        point.samples = saturate16(stats.samples);
+        point.rejected = saturate16(stats.rejected);
+        if (i < samples.length()) {
+            point.rawX = samples[i].x();
+            point.rawY = samples[i].y();
+            point.stdDevX = stats.stdDevX;
+            point.stdDevY = stats.stdDevY;
+            point.residual = calibrator.residual(i);
+            point.milliseconds = saturate32(static_cast<unsigned long>(qMax(0L, stats.milliseconds)));
+        }
+    }
+}
+
+/**
+ * @brief Adds a touchscreen's input statistics to a telemetry record
+ * @param record The record
+ * @param reader The event reader that read the touchscreen
+ * @param decoder The decoder that decoded it
+ * @param queueOverflows Samples dropped because the input thread's queue was full
+ *
+ * These add to what's already there, so a touchscreen that went away and came
+ * back partway through is counted in full.
+ */
+void Telemetry::addInput(TelemetryRecord &record, EventReader const &reader, TouchDecoder const &decoder,
+                         unsigned long queueOverflows)
+{
+    record.wakeups = saturate32(record.wakeups + reader.totalWakeups());
+    record.events = saturate32(record.events + reader.totalEvents());
+    record.droppedFrames = saturate32(record.droppedFrames + decoder.droppedFrames());
+    record.discardedEvents = saturate32(record.discardedEvents + decoder.discardedEvents());
+    record.failedResyncs = saturate32(record.failedResyncs + decoder.failedResyncs());
+    record.queueOverflows = saturate32(record.queueOverflows + queueOverflows);
+}
+
+/**
+ * @brief Adds the touch latency summary to a telemetry record
+ * @param record The record
+ * @param latency The latency statistics for the run
+ */
+void Telemetry::addLatency(TelemetryRecord &record, LatencyStats const &latency)
+{
+    for (int s = 0; s < LatencyStats::NumStages; s++) {
+        LatencyStats::Stage const stage = static_cast<LatencyStats::Stage>(s);
+        record.latency[s].frames = saturate32(latency.frames(stage));
+        record.latency[s].meanMicroseconds = saturate32(static_cast<unsigned long>(latency.meanMicroseconds(stage)));
+        record.latency[s].maxMicroseconds = saturate32(static_cast<unsigned long>(latency.maxMicroseconds(stage)));
+    }
+}
+
+/**
+ * @brief Determines whether a telemetry record is for a particular touchscreen
+ * @param record The record
+ * @param identity The touchscreen's identity
+ * @return True if the record describes it
+ */
+bool Telemetry::matches(TelemetryRecord const &record, TouchIdentity const &identity)
+{
+    return record.busType == identity.id.bustype && record.vendor == identity.id.vendor &&
+           record.product == identity.id.product && record.deviceVersion == identity.id.version &&
+           !strncmp(record.phys, identity.phys, sizeof(record.phys)) &&
+           !strncmp(record.uniq, identity.uniq, sizeof(record.uniq));
+}
+
+/**
+ * @brief Works out how long a phase took, for a telemetry record
+ * @param startSeconds When it started, in seconds since the process started
+ * @param endSeconds When it ended, on the same scale
+ * @return The length in milliseconds, or 0 if either time is unknown (negative)
+ */
+quint32 Telemetry::elapsedMilliseconds(double startSeconds, double endSeconds)
+{
+    if (startSeconds < 0 || endSeconds < startSeconds) {
+        return 0;
+    }
+    return saturate32(static_cast<unsigned long>((endSeconds - startSeconds) * 1000 + 0.5));
+}
+
+/**
+ * @brief Appends records to the telemetry file, keeping it to a bounded size
+ * @param path The telemetry file
+ * @param limit The size (in bytes) it can grow to
+ * @param records The records to add
+ * @return True on success, false on failure
+ *
+ * Once the file would grow past the limit, it's renamed to <path>.1 (replacing
+ * the one before) and a new one is started, so the two together never take up
+ * more than twice the limit. Everything is written with a single write() in
+ * append mode, so a reader never sees half of a run, and a record left
+ * partly written by a power failure is trimmed off before the next append.
+ */
+bool Telemetry::append(QString const &path, qint64 limit, QVector<TelemetryRecord> const &records)
+{
+    if (records.isEmpty()) {
+        return true;
+    }
+
+    QByteArray data;
+    for (TelemetryRecord record : records) {
+        record.checksum = CalibrationRecordFile::crc32(&record, offsetof(TelemetryRecord, checksum));
+        data.append(reinterpret_cast<char const *>(&record), sizeof(record));
+    }
+
+    QFile file(path);
+    if (file.exists() && file.size() + data.size() > limit) {
+        QString const rotated = path + ".1";
+        QFile::remove(rotated);
+        if (!QFile::rename(path, rotated)) {
+            qCritical("Unable to rotate telemetry file");
+            return false;
+        }
+    }
+
+    if (!file.open(QFile::WriteOnly | QFile::Append | QFile::Unbuffered)) {
+        qCritical("Unable to open telemetry file");
+        return false;
+    }
+
+    // If the last write was cut short, drop what's left of it so the new
+    // records still start on a record boundary
+    qint64 const partial = file.size() % static_cast<qint64>(sizeof(TelemetryRecord));
+    if (partial && !file.resize(file.size() - partial)) {
+        qCritical("Unable to repair telemetry file");
+        return false;
+    }
+    if (file.write(data) != data.size()) {
+        qCritical("Unable to write telemetry file");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Prints every record in one telemetry file as a CSV row
+ * @param path The file
+ * @return The number of intact records, or -1 if the file is damaged
+ */
+static int dumpFile(QString const &path)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly)) {
+        return 0;
+    }
+    QByteArray const data = file.readAll();
+
+    int count = 0;
+    for (int offset = 0; offset + static_cast<int>(sizeof(TelemetryRecord)) <= data.size();
+         offset += sizeof(TelemetryRecord)) {
+        TelemetryRecord record;
+        memcpy(&record, data.constData() + offset, sizeof(record));
+        if (memcmp(record.magic, TELEMETRY_MAGIC, sizeof(record.magic)) ||
+            record.version != TELEMETRY_VERSION || record.size != sizeof(record) ||
+            record.checksum != CalibrationRecordFile::crc32(&record, offsetof(TelemetryRecord, checksum)) ||
+            record.outcome > TelemetryIncomplete) {
+            return -1;
+        }
+
+        TouchIdentity identity;
+        identity.id.bustype = record.busType;
+        identity.id.vendor = record.vendor;
+        identity.id.product = record.product;
+        identity.id.version = record.deviceVersion;
+        memcpy(identity.phys, record.phys, sizeof(identity.phys));
+        memcpy(identity.uniq, record.uniq, sizeof(identity.uniq));
+
+        printf("%u,\"%s\",%s,%d,%d,%d,%u,%u,%.2f,%.1f,%.1f,%.1f,%.1f",
+               record.time, identity.key().constData(), outcomeNames[record.outcome],
+               (record.flags & TelemetryAffine) ? 1 : 0, (record.flags & TelemetrySaved) ? 1 : 0,
+               (record.flags & TelemetryApplied) ? 1 : 0, record.numPoints, record.capturedPoints,
+               static_cast<double>(record.maxResidual),
+               static_cast<double>(record.minXCal), static_cast<double>(record.maxXCal),
+               static_cast<double>(record.minYCal), static_cast<double>(record.maxYCal));
+        printf(",\"");
+        for (int i = 0; i < 9; i++) {
+            printf(i ? " %f" : "%f", static_cast<double>(record.matrix[i]));
+        }
+        printf("\",%u,%u,%u,%u,%u,%u", record.wakeups, record.events, record.droppedFrames,
+               record.discardedEvents, record.failedResyncs, record.queueOverflows);
+        for (int s = 0; s < LatencyStats::NumStages; s++) {
+            printf(",%u,%u", record.latency[s].meanMicroseconds, record.latency[s].maxMicroseconds);
+        }
+        for (int p = 0; p < NumTelemetryPhases; p++) {
+            printf(",%u", record.phaseMilliseconds[p]);
+        }
+
+        // Each point is target x/y, raw x/y, samples, rejected, spread x/y, error and time
+        printf(",\"");
+        for (int i = 0; i < record.numPoints && i < MAX_CAL_POINTS; i++) {
+            TelemetryPoint const &point = record.points[i];
+            printf("%s%u %u %d %d %u %u %.1f %.1f %.2f %u", i ? ";" : "",
+                   point.targetX, point.targetY, point.rawX, point.rawY, point.samples, point.rejected,
+                   static_cast<double>(point.stdDevX), static_cast<double>(point.stdDevY),
+                   static_cast<double>(point.residual), point.milliseconds);
+        }
+        printf("\"\n");
+        count++;
+    }
+
+    // Anything left over is a record that was cut short
+    if (data.size() % static_cast<int>(sizeof(TelemetryRecord))) {
+        return -1;
+    }
+    return count;
+}
+
+/**
+ * @brief Prints a telemetry file as CSV, oldest first
+ * @param path The telemetry file; the one rotated out to <path>.1 is printed first
+ * @return The process exit code: failure if there were no records, or any were damaged
+ */
+int Telemetry::dump(QString const &path)
+{
+    printf("time,device,outcome,affine,saved,applied,points,captured,max_residual,"
+           "min_x_cal,max_x_cal,min_y_cal,max_y_cal,matrix,wakeups,events,dropped_frames,"
+           "discarded_events,failed_resyncs,queue_overflows,kernel_to_read_mean_us,kernel_to_read_max_us,"
+           "read_to_handle_mean_us,read_to_handle_max_us,handle_to_paint_mean_us,handle_to_paint_max_us,"
+           "startup_ms,wait_ms,tap_ms,review_ms,save_ms,point_details\n");
+
+    bool damaged = false;
+    int total = 0;
+    QString const files[2] = { path + ".1", path };
+    for (QString const &file : files) {
+        int const count = dumpFile(file);
+        if (count < 0) {
+            qCritical("Telemetry file %s is damaged; stopped at the first bad record", file.toUtf8().constData());
+            damaged = true;
+        } else {
+            total += count;
+        }
+    }
+
+    if (total == 0 && !damaged) {
+        qCritical("No telemetry records found");
+        return EXIT_FAILURE;
+    }
+    return damaged ? EXIT_FAILURE : EXIT_SUCCESS;
+}
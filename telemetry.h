@@ -0,0 +1,171 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include "calibrator.h"
+#include "eventreader.h"
+#include "latencystats.h"
+#include "touchdecoder.h"
+#include "touchidentity.h"
+
+/// Size (in bytes) a telemetry file can grow to before it's moved aside to <file>.1
+#define TELEMETRY_DEFAULT_LIMIT         (64 * 1024)
+
+/// How a calibration run ended, as recorded in telemetry
+enum TelemetryOutcome
+{
+    TelemetrySucceeded,
+    TelemetrySolveFailed,
+    TelemetryResidualTooLarge,
+    TelemetryOutOfRange,
+    /// The program quit before every point was tapped
+    TelemetryIncomplete
+};
+
+/// Bits in TelemetryRecord::flags
+enum TelemetryFlag
+{
+    /// The full affine fit was used, rather than the four-corner scale and offset
+    TelemetryAffine = 0x01,
+    /// The calibration was saved
+    TelemetrySaved = 0x02,
+    /// The calibration was applied to X
+    TelemetryApplied = 0x04
+};
+
+/// The parts of a calibration run that are timed
+enum TelemetryPhase
+{
+    /// From process start until the first frame was on the screen
+    StartupPhase,
+    /// From then (or the previous touchscreen finishing) until the first touch
+    WaitPhase,
+    /// From the first touch until the last point was taken
+    TapPhase,
+    /// From then until the screen was tapped to save
+    ReviewPhase,
+    /// Saving the calibration and applying it to X
+    SavePhase,
+    /// Number of phases; not a phase itself
+    NumTelemetryPhases
+};
+
+/**
+ * @brief What happened at one calibration point
+ */
+struct TelemetryPoint
+{
+    qint32 rawX;
+    qint32 rawY;
+    quint16 targetX;
+    quint16 targetY;
+    quint16 samples;
+    quint16 rejected;
+    float stdDevX;
+    float stdDevY;
+    float residual;
+    quint32 milliseconds;
+};
+
+/**
+ * @brief The timing summary of one LatencyStats stage
+ */
+struct TelemetryStage
+{
+    quint32 frames;
+    quint32 meanMicroseconds;
+    quint32 maxMicroseconds;
+};
+
+/**
+ * @brief Everything worth knowing about one touchscreen's calibration run
+ *
+ * One of these is appended to the telemetry file for each touchscreen that
+ * was calibrated (or failed, or was left partway through), so bad panels and
+ * regressions can be picked out across a fleet afterwards without a debugger.
+ * Like CalibrationRecord it's fixed-size, little-endian and ends in a CRC-32
+ * of everything before it, so a record cut short by a power failure is easy
+ * to spot. Counters that don't fit saturate.
+ */
+struct TelemetryRecord
+{
+    char magic[4];
+    quint16 version;
+    quint16 size;
+    /// When the run ended, in seconds since the epoch
+    quint32 time;
+    /// A TelemetryOutcome
+    quint8 outcome;
+    /// TelemetryFlag bits
+    quint8 flags;
+    quint8 numPoints;
+    quint8 capturedPoints;
+    quint16 busType;
+    quint16 vendor;
+    quint16 product;
+    quint16 deviceVersion;
+    char phys[TOUCH_IDENTITY_STRING_SIZE];
+    char uniq[TOUCH_IDENTITY_STRING_SIZE];
+    quint16 screenWidth;
+    quint16 screenHeight;
+    qint32 xMinimum;
+    qint32 xMaximum;
+    qint32 yMinimum;
+    qint32 yMaximum;
+    float matrix[9];
+    float maxResidual;
+    /// The raw extremes of the screen under the calibration, which have to
+    /// fit within the ranges above
+    float minXCal;
+    float maxXCal;
+    float minYCal;
+    float maxYCal;
+    TelemetryPoint points[MAX_CAL_POINTS];
+    quint32 wakeups;
+    quint32 events;
+    quint32 droppedFrames;
+    quint32 discardedEvents;
+    quint32 failedResyncs;
+    quint32 queueOverflows;
+    TelemetryStage latency[LatencyStats::NumStages];
+    quint32 phaseMilliseconds[NumTelemetryPhases];
+    quint32 checksum;
+};
+
+/**
+ * @brief Fills in TelemetryRecords and keeps the telemetry file
+ */
+class Telemetry
+{
+public:
+    static void describe(TelemetryRecord &record, TouchIdentity const &identity, Calibrator const &calibrator);
+    static void addInput(TelemetryRecord &record, EventReader const &reader, TouchDecoder const &decoder,
+                         unsigned long queueOverflows);
+    static void addLatency(TelemetryRecord &record, LatencyStats const &latency);
+    static bool matches(TelemetryRecord const &record, TouchIdentity const &identity);
+    static quint32 elapsedMilliseconds(double startSeconds, double endSeconds);
+    static bool append(QString const &path, qint64 limit, QVector<TelemetryRecord> const &records);
+    static int dump(QString const &path);
+};
+
+#endif // TELEMETRY_H
@@ -0,0 +1,110 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Generates glyphdata.h, the pre-rasterized text used by the lite build.
+ * It's a host tool, not part of the normal build:
+ *
+ *   g++ -o rasterizeglyphs tools/rasterizeglyphs.cpp $(pkg-config --cflags --libs freetype2)
+ *   ./rasterizeglyphs /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf 20 > glyphdata.h
+ */
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+/// Printable ASCII is all the instructions use
+#define FIRST_GLYPH                     32
+#define LAST_GLYPH                      126
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s font.ttf pixel-size\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) || FT_New_Face(library, argv[1], 0, &face) ||
+        FT_Set_Pixel_Sizes(face, 0, atoi(argv[2]))) {
+        fprintf(stderr, "unable to load %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    // Every glyph is stored as a full-height cell as wide as its advance, so
+    // drawing a string is just copying cells side by side
+    int const ascent = static_cast<int>(face->size->metrics.ascender >> 6);
+    int const height = static_cast<int>((face->size->metrics.ascender - face->size->metrics.descender) >> 6);
+    std::vector<unsigned char> data;
+    std::vector<int> widths;
+    std::vector<size_t> offsets;
+    for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+            fprintf(stderr, "unable to render glyph %d\n", c);
+            return EXIT_FAILURE;
+        }
+        FT_GlyphSlot const slot = face->glyph;
+        int const width = static_cast<int>((slot->advance.x + 32) >> 6);
+        offsets.push_back(data.size());
+        widths.push_back(width);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int const bx = x - slot->bitmap_left;
+                int const by = y - (ascent - slot->bitmap_top);
+                unsigned char value = 0;
+                if (bx >= 0 && by >= 0 && bx < static_cast<int>(slot->bitmap.width) &&
+                    by < static_cast<int>(slot->bitmap.rows)) {
+                    value = slot->bitmap.buffer[by * slot->bitmap.pitch + bx];
+                }
+                data.push_back(value);
+            }
+        }
+    }
+
+    printf("/* Generated by tools/rasterizeglyphs.cpp from %s at %s pixels. Do not edit.\n", argv[1], argv[2]);
+    printf(" * The glyph shapes are from the DejaVu fonts; see https://dejavu-fonts.github.io/License.html */\n\n");
+    printf("#ifndef GLYPHDATA_H\n#define GLYPHDATA_H\n\n");
+    printf("/// First character in the glyph set\n#define GLYPH_FIRST                     %d\n", FIRST_GLYPH);
+    printf("/// Number of characters in the glyph set\n#define GLYPH_COUNT                     %d\n",
+           LAST_GLYPH - FIRST_GLYPH + 1);
+    printf("/// Height of every glyph cell in pixels\n#define GLYPH_HEIGHT                    %d\n\n", height);
+    printf("/// Width of each glyph cell in pixels (its advance)\n");
+    printf("static unsigned char const glyphWidths[GLYPH_COUNT] = {");
+    for (size_t i = 0; i < widths.size(); i++) {
+        printf("%s%d", i % 16 ? ", " : (i ? ",\n    " : "\n    "), widths[i]);
+    }
+    printf("\n};\n\n/// Where each glyph's cell starts in glyphAlpha\n");
+    printf("static unsigned short const glyphOffsets[GLYPH_COUNT] = {");
+    for (size_t i = 0; i < offsets.size(); i++) {
+        printf("%s%u", i % 12 ? ", " : (i ? ",\n    " : "\n    "), static_cast<unsigned>(offsets[i]));
+    }
+    printf("\n};\n\n/// Coverage of every pixel of every cell, row by row (0 is clear, 255 is solid)\n");
+    printf("static unsigned char const glyphAlpha[%u] = {", static_cast<unsigned>(data.size()));
+    for (size_t i = 0; i < data.size(); i++) {
+        printf("%s%u", i % 16 ? "," : (i ? ",\n    " : "\n    "), data[i]);
+    }
+    printf("\n};\n\n#endif // GLYPHDATA_H\n");
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOUCHAXES_H
+#define TOUCHAXES_H
+
+/// The range of raw samples assumed when the touchscreen doesn't tell us
+#define RAW_TOUCHSCREEN_RANGE           4095
+
+/**
+ * @brief What the driver reports about one axis of the touchscreen (from input_absinfo)
+ */
+struct AxisInfo
+{
+    AxisInfo() :
+        minimum(0),
+        maximum(RAW_TOUCHSCREEN_RANGE),
+        fuzz(0),
+        resolution(0)
+    {
+    }
+
+    /// Lowest raw value
+    int minimum;
+    /// Highest raw value
+    int maximum;
+    /// Noise level; the kernel filters out changes smaller than this
+    int fuzz;
+    /// Units per millimeter, or 0 if unknown
+    int resolution;
+
+    /// Distance from the lowest to the highest raw value
+    int span() const { return maximum - minimum; }
+    /// Converts a raw value to 0...1, the same way libinput does before applying the matrix
+    double normalize(double raw) const { return (raw - minimum) / span(); }
+    /// Converts a value from 0...1 back to raw units
+    double denormalize(double normalized) const { return normalized * span() + minimum; }
+};
+
+/**
+ * @brief The ranges of both axes of the touchscreen
+ */
+struct TouchAxes
+{
+    AxisInfo x;
+    AxisInfo y;
+};
+
+#endif // TOUCHAXES_H
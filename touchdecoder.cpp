@@ -0,0 +1,319 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "touchdecoder.h"
+#include <QtGlobal>
+#include <algorithm>
+#include <sys/ioctl.h>
+
+/**
+ * @brief Constructor for TouchDecoder
+ */
+TouchDecoder::TouchDecoder() :
+    _fd(-1),
+    _droppedFrames(0),
+    _discardedEvents(0),
+    _failedResyncs(0)
+{
+    reset();
+}
+
+/**
+ * @brief Forgets everything about the touch state, as if the device had just been opened
+ */
+void TouchDecoder::reset()
+{
+    _curSlot = &_slots[0];
+    _activeSlots = 0;
+    _primarySlot = -1;
+    _multitouch = false;
+    _multitouchPressure = false;
+    _singleAxes = false;
+    _singleXY = QPoint();
+    _singlePressed = false;
+    _singlePressure = -1;
+    _dropping = false;
+    for (int i = 0; i < MAX_TOUCH_SLOTS; i++) {
+        _slots[i].trackingId = -1;
+        _slots[i].x = 0;
+        _slots[i].y = 0;
+        _slots[i].pressure = -1;
+    }
+    _sample.pressed = false;
+    _sample.pressure = -1;
+    _sample.time.tv_sec = 0;
+    _sample.time.tv_usec = 0;
+    _sample.readTime.tv_sec = 0;
+    _sample.readTime.tv_usec = 0;
+    _sample.resynced = false;
+}
+
+/**
+ * @brief Feeds one raw event into the decoder
+ * @param event The event read from the touchscreen
+ * @return True if this event completed a frame, in which case sample() is updated
+ */
+bool TouchDecoder::processEvent(input_event const &event)
+{
+    // After an overflow, the rest of the broken frame is worthless. The
+    // SYN_REPORT that ends it becomes a frame built from the device's real state.
+    if (_dropping) {
+        if (event.type == EV_SYN && event.code == SYN_REPORT) {
+            _dropping = false;
+            resync();
+            finishFrame(event.time);
+            _sample.resynced = true;
+            return true;
+        }
+        _discardedEvents++;
+        return false;
+    }
+
+    switch (event.type) {
+    case EV_KEY:
+        // Look for touch state change
+        if (event.code == BTN_TOUCH) {
+            _singlePressed = event.value != 0;
+        }
+        break;
+    case EV_ABS:
+        switch (event.code) {
+        case ABS_X:
+            _singleAxes = true;
+            _singleXY.setX(event.value);
+            break;
+        case ABS_Y:
+            _singleAxes = true;
+            _singleXY.setY(event.value);
+            break;
+        case ABS_PRESSURE:
+            _singlePressure = event.value;
+            break;
+        case ABS_MT_SLOT:
+            // Slots we don't have room for are dropped here, once, rather than
+            // checking the slot number on every position event that follows
+            _multitouch = true;
+            _curSlot = (event.value >= 0 && event.value < MAX_TOUCH_SLOTS) ? &_slots[event.value] : nullptr;
+            break;
+        case ABS_MT_TRACKING_ID:
+            _multitouch = true;
+            if (_curSlot) {
+                unsigned int const bit = 1u << (_curSlot - _slots);
+                _curSlot->trackingId = event.value;
+                if (event.value < 0) {
+                    _activeSlots &= ~bit;
+                } else {
+                    _activeSlots |= bit;
+                }
+            }
+            break;
+        case ABS_MT_POSITION_X:
+            if (_curSlot) {
+                _curSlot->x = event.value;
+            }
+            break;
+        case ABS_MT_POSITION_Y:
+            if (_curSlot) {
+                _curSlot->y = event.value;
+            }
+            break;
+        case ABS_MT_PRESSURE:
+            _multitouchPressure = true;
+            if (_curSlot) {
+                _curSlot->pressure = event.value;
+            }
+            break;
+        }
+        break;
+    case EV_SYN:
+        // When a syn report occurs, we have a full sample to process from the touchscreen
+        if (event.code == SYN_REPORT) {
+            finishFrame(event.time);
+            return true;
+        }
+        // The kernel ran out of room and lost events. Whatever we're in the
+        // middle of may be half updated, so stop using events until it's over.
+        if (event.code == SYN_DROPPED) {
+            _dropping = true;
+            _droppedFrames++;
+        }
+        break;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Builds the output sample at the end of a frame
+ * @param time The kernel timestamp of the SYN_REPORT
+ */
+void TouchDecoder::finishFrame(timeval const &time)
+{
+    _sample.time = time;
+    _sample.resynced = false;
+
+    if (!_multitouch) {
+        _sample.xy = _singleXY;
+        _sample.pressed = _singlePressed;
+        _sample.pressure = _singlePressure;
+        return;
+    }
+
+    // Keep following the same contact for as long as it stays down, so a
+    // second finger landing doesn't yank the sample over to it. When the
+    // primary contact lifts, report a release even if other contacts remain;
+    // one of them gets promoted on the next frame as a fresh press instead of
+    // appearing as a jump in position.
+    if (_primarySlot >= 0 && !(_activeSlots & (1u << _primarySlot))) {
+        _primarySlot = -1;
+        _sample.pressed = false;
+        return;
+    }
+    if (_primarySlot < 0 && _activeSlots) {
+        _primarySlot = __builtin_ctz(_activeSlots);
+    }
+
+    if (_primarySlot >= 0) {
+        _sample.xy = QPoint(_slots[_primarySlot].x, _slots[_primarySlot].y);
+        _sample.pressure = _slots[_primarySlot].pressure;
+        _sample.pressed = true;
+    } else {
+        // Nothing touching; leave the last known location in place
+        _sample.pressed = false;
+    }
+}
+
+/**
+ * @brief Reads the current touch state straight from the device after events were dropped
+ *
+ * Without a device (such as when replaying a capture), the state from before
+ * the overflow is kept and only the discarded events are lost.
+ */
+void TouchDecoder::resync()
+{
+    if (_fd < 0) {
+        return;
+    }
+
+    // A multitouch-only device has no legacy axes, so they only have to be
+    // there if the device has been sending them
+    bool ok = true;
+    input_absinfo info;
+    if (ioctl(_fd, EVIOCGABS(ABS_X), &info) >= 0) {
+        _singleXY.setX(info.value);
+    } else if (_singleAxes) {
+        ok = false;
+    }
+    if (ioctl(_fd, EVIOCGABS(ABS_Y), &info) >= 0) {
+        _singleXY.setY(info.value);
+    } else if (_singleAxes) {
+        ok = false;
+    }
+    // Pressure is optional, so only ask for it if the device has been sending it
+    if (_singlePressure >= 0 && ioctl(_fd, EVIOCGABS(ABS_PRESSURE), &info) >= 0) {
+        _singlePressure = info.value;
+    }
+
+    unsigned char keys[KEY_MAX / 8 + 1];
+    if (ioctl(_fd, EVIOCGKEY(sizeof(keys)), keys) >= 0) {
+        _singlePressed = (keys[BTN_TOUCH / 8] >> (BTN_TOUCH % 8)) & 1;
+    } else {
+        ok = false;
+    }
+
+    // The kernel only fills in as many values as the device has slots, so
+    // find out how many that is before asking for any of them
+    if (_multitouch && ioctl(_fd, EVIOCGABS(ABS_MT_SLOT), &info) < 0) {
+        ok = false;
+    } else if (_multitouch) {
+        int const numSlots = qBound(0, info.maximum + 1, MAX_TOUCH_SLOTS);
+
+        // The next position events go to whichever slot the device is on now
+        _curSlot = (info.value >= 0 && info.value < MAX_TOUCH_SLOTS) ? &_slots[info.value] : nullptr;
+
+        // Each request returns one axis for every slot
+        struct
+        {
+            __u32 code;
+            __s32 values[MAX_TOUCH_SLOTS];
+        } slots;
+
+        slots.code = ABS_MT_TRACKING_ID;
+        std::fill(slots.values, slots.values + MAX_TOUCH_SLOTS, -1);
+        if (ioctl(_fd, EVIOCGMTSLOTS(sizeof(slots)), &slots) >= 0) {
+            _activeSlots = 0;
+            for (int i = 0; i < numSlots; i++) {
+                _slots[i].trackingId = slots.values[i];
+                if (slots.values[i] >= 0) {
+                    _activeSlots |= 1u << i;
+                }
+            }
+        } else {
+            ok = false;
+        }
+
+        slots.code = ABS_MT_POSITION_X;
+        std::fill(slots.values, slots.values + MAX_TOUCH_SLOTS, 0);
+        if (ioctl(_fd, EVIOCGMTSLOTS(sizeof(slots)), &slots) >= 0) {
+            for (int i = 0; i < numSlots; i++) {
+                _slots[i].x = slots.values[i];
+            }
+        } else {
+            ok = false;
+        }
+
+        slots.code = ABS_MT_POSITION_Y;
+        std::fill(slots.values, slots.values + MAX_TOUCH_SLOTS, 0);
+        if (ioctl(_fd, EVIOCGMTSLOTS(sizeof(slots)), &slots) >= 0) {
+            for (int i = 0; i < numSlots; i++) {
+                _slots[i].y = slots.values[i];
+            }
+        } else {
+            ok = false;
+        }
+
+        // The kernel answers for any multitouch axis, even one the device doesn't have
+        slots.code = ABS_MT_PRESSURE;
+        std::fill(slots.values, slots.values + MAX_TOUCH_SLOTS, 0);
+        if (_multitouchPressure && ioctl(_fd, EVIOCGMTSLOTS(sizeof(slots)), &slots) >= 0) {
+            for (int i = 0; i < numSlots; i++) {
+                _slots[i].pressure = slots.values[i];
+            }
+        }
+    }
+
+    if (!ok) {
+        _failedResyncs++;
+    }
+}
+
+/**
+ * @brief Prints how often the kernel's event buffer overflowed
+ *
+ * If this happens regularly, events aren't being read fast enough for the
+ * size of the evdev client buffer.
+ */
+void TouchDecoder::logStatistics() const
+{
+    if (_droppedFrames == 0) {
+        return;
+    }
+
+    qDebug("Kernel event buffer overflowed %lu times (%lu more events discarded while resyncing, "
+           "%lu resyncs failed)", _droppedFrames, _discardedEvents, _failedResyncs);
+}
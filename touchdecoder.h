@@ -0,0 +1,110 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOUCHDECODER_H
+#define TOUCHDECODER_H
+
+#include <QPoint>
+#include <linux/input.h>
+
+/// Number of multitouch slots tracked; contacts in higher slots are ignored
+#define MAX_TOUCH_SLOTS                 10
+
+/**
+ * @brief One complete touch state update, as of a SYN_REPORT
+ */
+struct TouchSample
+{
+    /// The last known raw touch location
+    QPoint xy;
+    /// True if the screen is touched, false if not
+    bool pressed;
+    /// Raw pressure of the touch, or -1 if the device doesn't report pressure
+    int pressure;
+    /// Kernel timestamp of the SYN_REPORT that completed this sample
+    timeval time;
+    /// When this sample was read from the kernel (same clock as time), or zero if unknown
+    timeval readTime;
+    /// True if events were dropped just before this sample, so the touch it
+    /// belongs to may be missing some of its history
+    bool resynced;
+};
+
+/**
+ * @brief Turns a stream of raw evdev events into complete touch samples
+ *
+ * Handles both the single-touch protocol (ABS_X/ABS_Y/BTN_TOUCH) and the
+ * type B multitouch protocol (ABS_MT_SLOT/ABS_MT_TRACKING_ID/ABS_MT_POSITION_*).
+ * As soon as a device sends multitouch events, its slots are used instead of
+ * the single-touch emulation, and one primary contact is picked from them.
+ *
+ * If the kernel's buffer overflows, it sends SYN_DROPPED. Everything up to the
+ * next SYN_REPORT is then thrown away, and if a device was given with setDevice(),
+ * the current state is read back from it so nothing stays stuck (such as a
+ * touch that was released while its events were lost).
+ */
+class TouchDecoder
+{
+public:
+    TouchDecoder();
+
+    void reset();
+    void setDevice(int fd) { _fd = fd; }
+    bool processEvent(input_event const &event);
+    TouchSample const &sample() const { return _sample; }
+    bool isMultitouch() const { return _multitouch; }
+    unsigned long droppedFrames() const { return _droppedFrames; }
+    unsigned long discardedEvents() const { return _discardedEvents; }
+    unsigned long failedResyncs() const { return _failedResyncs; }
+    void logStatistics() const;
+
+private:
+    /// State of one multitouch slot
+    struct Slot
+    {
+        int trackingId;
+        int x;
+        int y;
+        int pressure;
+    };
+
+    void finishFrame(timeval const &time);
+    void resync();
+
+    Slot _slots[MAX_TOUCH_SLOTS];
+    Slot *_curSlot;
+    unsigned int _activeSlots;
+    int _primarySlot;
+    bool _multitouch;
+    bool _multitouchPressure;
+
+    bool _singleAxes;
+    QPoint _singleXY;
+    bool _singlePressed;
+    int _singlePressure;
+
+    TouchSample _sample;
+
+    int _fd;
+    bool _dropping;
+    unsigned long _droppedFrames;
+    unsigned long _discardedEvents;
+    unsigned long _failedResyncs;
+};
+
+#endif // TOUCHDECODER_H
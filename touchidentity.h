@@ -0,0 +1,80 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOUCHIDENTITY_H
+#define TOUCHIDENTITY_H
+
+#include <QByteArray>
+#include <linux/input.h>
+#include <stdio.h>
+#include <string.h>
+
+/// Longest physical path or unique ID kept for identifying a touchscreen (including the terminator)
+#define TOUCH_IDENTITY_STRING_SIZE      32
+
+/**
+ * @brief Who a touchscreen is, independent of which /dev/input node it got this boot
+ *
+ * Two panels of the same model have the same name and EVIOCGID, so the
+ * physical path (where it's attached) and unique ID (often empty) from the
+ * driver are what tell them apart.
+ */
+struct TouchIdentity
+{
+    TouchIdentity()
+    {
+        memset(&id, 0, sizeof(id));
+        memset(phys, 0, sizeof(phys));
+        memset(uniq, 0, sizeof(uniq));
+    }
+
+    /// Bus type, vendor, product and version (from EVIOCGID)
+    input_id id;
+    /// Where the device is attached, like "usb-0000:00:14.0-2/input0" (from EVIOCGPHYS)
+    char phys[TOUCH_IDENTITY_STRING_SIZE];
+    /// Unique ID such as a serial number, or empty if the driver doesn't have one (from EVIOCGUNIQ)
+    char uniq[TOUCH_IDENTITY_STRING_SIZE];
+
+    /// Determines whether this is the same touchscreen as another
+    bool operator==(TouchIdentity const &other) const
+    {
+        return id.bustype == other.id.bustype && id.vendor == other.id.vendor &&
+               id.product == other.id.product && id.version == other.id.version &&
+               !strncmp(phys, other.phys, sizeof(phys)) && !strncmp(uniq, other.uniq, sizeof(uniq));
+    }
+    bool operator!=(TouchIdentity const &other) const { return !(*this == other); }
+
+    /// A readable form, for messages
+    QByteArray key() const
+    {
+        char ids[24];
+        snprintf(ids, sizeof(ids), "%04x:%04x:%04x:%04x", id.bustype, id.vendor, id.product, id.version);
+        QByteArray result(ids);
+        if (phys[0]) {
+            result += ' ';
+            result += QByteArray(phys, static_cast<int>(strnlen(phys, sizeof(phys))));
+        }
+        if (uniq[0]) {
+            result += ' ';
+            result += QByteArray(uniq, static_cast<int>(strnlen(uniq, sizeof(uniq))));
+        }
+        return result;
+    }
+};
+
+#endif // TOUCHIDENTITY_H
@@ -0,0 +1,154 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "touchscreendevice.h"
+#include "calibrationutils.h"
+#include <errno.h>
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructor for TouchScreenDevice
+ * @param fd The touchscreen's (non-blocking) file descriptor, which this object now owns
+ * @param path The device node it was opened from
+ */
+TouchScreenDevice::TouchScreenDevice(int fd, QString const &path) :
+    _fd(fd),
+    _path(path),
+    _clock(CLOCK_MONOTONIC),
+    _grabbed(false),
+    _pressed(false),
+    _inputThread(nullptr)
+{
+    // Have the kernel timestamp events with the monotonic clock so they can be
+    // compared against our own timestamps without worrying about the time of day
+    // changing. Older kernels can't do this, so stick with the real time clock there.
+    int clock = CLOCK_MONOTONIC;
+    if (ioctl(_fd, EVIOCSCLOCKID, &clock) < 0) {
+        qDebug("Unable to switch touchscreen timestamps to the monotonic clock");
+        _clock = CLOCK_REALTIME;
+    }
+    _eventReader.setClock(_clock);
+
+    // The calibration math needs the touchscreen's real ranges, whatever they are
+    CalibrationUtils::readTouchAxes(_fd, _axes);
+    CalibrationUtils::readDeviceIdentity(_fd, _identity);
+    _decoder.setDevice(_fd);
+}
+
+/**
+ * @brief Destructor for TouchScreenDevice. Stops the input thread, releases any grab and closes the device.
+ */
+TouchScreenDevice::~TouchScreenDevice()
+{
+    delete _inputThread;
+    release();
+    ::close(_fd);
+}
+
+/**
+ * @brief Keeps everything else, including X, from seeing this touchscreen's events
+ * @return True on success, false on failure
+ */
+bool TouchScreenDevice::grab()
+{
+    if (!_grabbed && ioctl(_fd, EVIOCGRAB, 1) < 0) {
+        qCritical("Unable to grab the touchscreen at %s, X will see the touches too",
+                  _path.toUtf8().constData());
+        return false;
+    }
+    _grabbed = true;
+    return true;
+}
+
+/**
+ * @brief Lets the rest of the system see the touchscreen again, if it was grabbed
+ *
+ * The kernel also drops the grab when the device is closed, which covers the
+ * ways out that never get here, like a crash or SIGKILL.
+ */
+void TouchScreenDevice::release()
+{
+    if (!_grabbed) {
+        return;
+    }
+
+    // If the device is already gone, so is the grab
+    if (ioctl(_fd, EVIOCGRAB, 0) < 0 && errno != ENODEV) {
+        qCritical("Unable to release the touchscreen grab");
+    }
+    _grabbed = false;
+}
+
+/**
+ * @brief Has a separate thread read and decode this touchscreen from now on
+ * @param recorder If not null, every raw event is also written here (from the input thread)
+ *
+ * Painting then can't hold up sampling. The thread wakes whoever is watching
+ * readyFd() when samples are queued.
+ */
+void TouchScreenDevice::startInputThread(CaptureWriter *recorder)
+{
+    if (_inputThread) {
+        return;
+    }
+
+    _inputThread = new InputThread(_fd, recorder);
+    _inputThread->setClock(_clock);
+    _inputThread->start(QThread::TimeCriticalPriority);
+}
+
+/**
+ * @brief Stops the input thread, if there is one, without getting rid of it
+ *
+ * Its statistics can be read after this, and nothing more is read from the device.
+ */
+void TouchScreenDevice::stopInputThread()
+{
+    if (_inputThread) {
+        _inputThread->stop();
+    }
+}
+
+/**
+ * @brief Prints input statistics. With an input thread, only valid once it's stopped.
+ */
+void TouchScreenDevice::logStatistics() const
+{
+    if (_inputThread) {
+        _inputThread->logStatistics();
+    } else {
+        _eventReader.logStatistics();
+        _decoder.logStatistics();
+    }
+}
+
+/**
+ * @brief Adds input statistics to a telemetry record. With an input thread, only valid once it's stopped.
+ * @param record The record
+ */
+void TouchScreenDevice::addTelemetry(TelemetryRecord &record) const
+{
+    if (_inputThread) {
+        Telemetry::addInput(record, _inputThread->eventReader(), _inputThread->decoder(),
+                            _inputThread->queueOverflows());
+    } else {
+        Telemetry::addInput(record, _eventReader, _decoder, 0);
+    }
+}
@@ -0,0 +1,79 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOUCHSCREENDEVICE_H
+#define TOUCHSCREENDEVICE_H
+
+#include <QString>
+#include <time.h>
+#include "capturefile.h"
+#include "eventreader.h"
+#include "inputthread.h"
+#include "telemetry.h"
+#include "touchaxes.h"
+#include "touchdecoder.h"
+#include "touchidentity.h"
+
+/**
+ * @brief One opened touchscreen, and everything needed to read it
+ *
+ * Each touchscreen gets its own event reader and decoder (or its own input
+ * thread), so several can be read side by side without their touch state
+ * getting mixed up. The axis ranges and identity are read once when it's opened.
+ */
+class TouchScreenDevice
+{
+public:
+    TouchScreenDevice(int fd, QString const &path);
+    ~TouchScreenDevice();
+
+    bool grab();
+    void release();
+    void startInputThread(CaptureWriter *recorder);
+    void stopInputThread();
+
+    int fd() const { return _fd; }
+    QString const &path() const { return _path; }
+    TouchIdentity const &identity() const { return _identity; }
+    TouchAxes const &axes() const { return _axes; }
+    clockid_t clock() const { return _clock; }
+    int readyFd() const { return _inputThread ? _inputThread->notifyFd() : _fd; }
+    InputThread *inputThread() const { return _inputThread; }
+    EventReader &eventReader() { return _eventReader; }
+    TouchDecoder &decoder() { return _decoder; }
+    bool isPressed() const { return _pressed; }
+    void setPressed(bool pressed) { _pressed = pressed; }
+    void logStatistics() const;
+    void addTelemetry(TelemetryRecord &record) const;
+
+private:
+    Q_DISABLE_COPY(TouchScreenDevice)
+
+    int _fd;
+    QString _path;
+    TouchIdentity _identity;
+    TouchAxes _axes;
+    clockid_t _clock;
+    bool _grabbed;
+    bool _pressed;
+    EventReader _eventReader;
+    TouchDecoder _decoder;
+    InputThread *_inputThread;
+};
+
+#endif // TOUCHSCREENDEVICE_H
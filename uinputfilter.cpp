@@ -0,0 +1,494 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "uinputfilter.h"
+#include "calibrationtransform.h"
+#include "calibrationutils.h"
+#include "touchscreendevice.h"
+#include <QStringList>
+#include <cstdlib>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <linux/uinput.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// Where virtual input devices are created
+#define UINPUT_PATH                     "/dev/uinput"
+/// The framebuffer that the virtual touchscreen's coordinates cover
+#define FRAMEBUFFER_PATH                "/dev/fb0"
+/// Most events written for one touch sample: X, Y, BTN_TOUCH and SYN_REPORT
+#define FILTER_EVENTS_PER_SAMPLE        4
+
+/**
+ * @brief Everything the filter tracks for one touchscreen
+ */
+struct FilterDevice
+{
+    FilterDevice(int fd, QString const &path) :
+        touchScreen(fd, path),
+        uinputFd(-1),
+        touchFrames(0),
+        down(false),
+        forwarded(0),
+        gated(0),
+        writeErrors(0)
+    {
+    }
+
+    TouchScreenDevice touchScreen;
+    /// The virtual touchscreen its calibrated touches go out through
+    int uinputFd;
+    CalibrationTransform transform;
+    int touchFrames;
+    /// True if the virtual touchscreen is being touched
+    bool down;
+    unsigned long forwarded;
+    unsigned long gated;
+    unsigned long writeErrors;
+};
+
+/// What the filter does with one decoded sample
+enum FilterAction
+{
+    DropSample,
+    PressSample,
+    MoveSample,
+    ReleaseSample
+};
+
+/// Socket pair the signal handler uses to wake up the poll loop
+static int signalFds[2] = {-1, -1};
+
+/**
+ * @brief Decides what a touch sample turns into on the virtual touchscreen
+ * @param device The touchscreen it came from
+ * @param sample The decoded touch state
+ * @param gate Which samples of each touch are good enough to pass on
+ * @return What to send
+ *
+ * The touch only starts once a sample gets through the gate, so the wild
+ * first frames of a tap on a resistive panel never reach anyone. Light
+ * samples in the middle of a touch are dropped, which leaves the touch where
+ * it was.
+ */
+static FilterAction filterSample(FilterDevice *device, TouchSample const &sample, PressureGate const &gate)
+{
+    if (sample.pressed) {
+        device->touchFrames++;
+        if (device->touchFrames <= gate.settleFrames ||
+            (sample.pressure >= 0 && sample.pressure < gate.minPressure)) {
+            device->gated++;
+            return DropSample;
+        }
+        if (!device->down) {
+            device->down = true;
+            return PressSample;
+        }
+        return MoveSample;
+    }
+
+    device->touchFrames = 0;
+    if (device->down) {
+        device->down = false;
+        return ReleaseSample;
+    }
+    return DropSample;
+}
+
+/**
+ * @brief Fills in one event to send to the virtual touchscreen
+ * @param event The event
+ * @param type The event type
+ * @param code The event code
+ * @param value The value
+ */
+static void setEvent(input_event &event, quint16 type, quint16 code, qint32 value)
+{
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.code = code;
+    event.value = value;
+}
+
+/**
+ * @brief Rounds a Q16.16 screen coordinate to a pixel on the screen
+ * @param value The coordinate
+ * @param size The screen's width or height
+ * @return The nearest pixel, clamped to the screen
+ */
+static qint32 toPixel(qint32 value, int size)
+{
+    return qBound(0, (value + 0x8000) >> 16, size - 1);
+}
+
+/**
+ * @brief Constructor for UinputFilter
+ * @param gate Which samples of each touch to pass on
+ */
+UinputFilter::UinputFilter(PressureGate const &gate) :
+    _gate(gate)
+{
+}
+
+/**
+ * @brief Destructor for UinputFilter
+ */
+UinputFilter::~UinputFilter()
+{
+    for (FilterDevice *device : _devices) {
+        if (device->uinputFd >= 0) {
+            ioctl(device->uinputFd, UI_DEV_DESTROY);
+            ::close(device->uinputFd);
+        }
+        delete device;
+    }
+    if (signalFds[0] >= 0) {
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        signal(SIGHUP, SIG_DFL);
+        ::close(signalFds[0]);
+        ::close(signalFds[1]);
+        signalFds[0] = signalFds[1] = -1;
+    }
+}
+
+/**
+ * @brief Runs until SIGINT or SIGTERM, or until every touchscreen is gone
+ * @return The process exit code
+ */
+int UinputFilter::run()
+{
+    if (!framebufferSize(_screenSize)) {
+        qCritical("Unable to find the screen size from " FRAMEBUFFER_PATH);
+        return EXIT_FAILURE;
+    }
+    if (!openDevices() || !loadCalibrations() || !setupSignals()) {
+        return EXIT_FAILURE;
+    }
+
+    pollfd fds[MAX_CALIBRATION_RECORDS + 1];
+    bool quit = false;
+    while (!quit) {
+        if (_devices.isEmpty()) {
+            qCritical("No touchscreens left to filter");
+            return EXIT_FAILURE;
+        }
+
+        fds[0].fd = signalFds[0];
+        fds[0].events = POLLIN;
+        for (int i = 0; i < _devices.length(); i++) {
+            fds[i + 1].fd = _devices[i]->touchScreen.fd();
+            fds[i + 1].events = POLLIN;
+        }
+        if (::poll(fds, _devices.length() + 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            qCritical("uinput filter poll failed");
+            return EXIT_FAILURE;
+        }
+
+        // Any number of signals can be waiting; a quit wins over a reload
+        if (fds[0].revents) {
+            bool reload = false;
+            char signums[16];
+            ssize_t length;
+            while ((length = ::read(signalFds[0], signums, sizeof(signums))) > 0) {
+                for (ssize_t i = 0; i < length; i++) {
+                    if (signums[i] == SIGHUP) {
+                        reload = true;
+                    } else {
+                        quit = true;
+                    }
+                }
+            }
+            if (quit) {
+                break;
+            }
+            if (reload && !loadCalibrations()) {
+                qCritical("Keeping the previous calibration");
+            }
+        }
+
+        for (int i = _devices.length() - 1; i >= 0; i--) {
+            if (fds[i + 1].revents && !readDevice(_devices[i])) {
+                qDebug("Touchscreen at %s disappeared", _devices[i]->touchScreen.path().toUtf8().constData());
+                FilterDevice *device = _devices[i];
+                _devices.removeAt(i);
+                ioctl(device->uinputFd, UI_DEV_DESTROY);
+                ::close(device->uinputFd);
+                delete device;
+            }
+        }
+    }
+
+    for (FilterDevice const *device : _devices) {
+        qDebug("%s: %lu samples forwarded, %lu ignored by the pressure gate, %lu write errors",
+               device->touchScreen.path().toUtf8().constData(), device->forwarded, device->gated,
+               device->writeErrors);
+        device->touchScreen.logStatistics();
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Finds the touchscreens, takes them over, and makes a virtual one for each
+ * @return True if at least one touchscreen is being filtered
+ */
+bool UinputFilter::openDevices()
+{
+    QVector<int> fds;
+    QStringList paths;
+    if (!CalibrationUtils::findTouchScreens(false, fds, paths)) {
+        return false;
+    }
+
+    for (int i = 0; i < fds.length(); i++) {
+        if (_devices.length() >= MAX_CALIBRATION_RECORDS) {
+            ::close(fds[i]);
+            continue;
+        }
+
+        // Without the grab, everything would see every touch twice: raw and calibrated
+        FilterDevice *device = new FilterDevice(fds[i], paths[i]);
+        if (!device->touchScreen.grab() || !createVirtualDevice(device)) {
+            delete device;
+            continue;
+        }
+        _devices.append(device);
+    }
+    return !_devices.isEmpty();
+}
+
+/**
+ * @brief Loads the saved calibration for every touchscreen
+ * @return True on success. On failure, every touchscreen keeps the calibration it had.
+ */
+bool UinputFilter::loadCalibrations()
+{
+    // Records know which touchscreen they're for; the config file only knows the node
+    QVector<CalibrationRecord> records;
+    QList<DeviceCalibration> calibrations;
+    if (!CalibrationUtils::loadCalibrationRecords(records) &&
+        !CalibrationUtils::loadSavedCalibration(calibrations)) {
+        qCritical("There's no saved calibration to apply; calibrate first");
+        return false;
+    }
+
+    QVector<CalibrationTransform> transforms;
+    for (FilterDevice const *device : _devices) {
+        float matrix[9];
+        if (!CalibrationUtils::findSavedMatrix(records, calibrations, device->touchScreen.identity(),
+                                               device->touchScreen.path(), matrix)) {
+            qCritical("No saved calibration for touchscreen %s", device->touchScreen.path().toUtf8().constData());
+            return false;
+        }
+        transforms.append(CalibrationTransform(matrix, device->touchScreen.axes(), _screenSize));
+    }
+
+    for (int i = 0; i < _devices.length(); i++) {
+        _devices[i]->transform = transforms[i];
+    }
+    return true;
+}
+
+/**
+ * @brief Creates the virtual touchscreen that a touchscreen's calibrated touches go out through
+ * @param device The touchscreen
+ * @return True on success, false on failure
+ *
+ * This uses the original uinput setup (writing a uinput_user_dev), which
+ * every kernel the Chumby might be running understands.
+ */
+bool UinputFilter::createVirtualDevice(FilterDevice *device)
+{
+    int const fd = ::open(UINPUT_PATH, O_WRONLY | O_CLOEXEC);
+    if (fd < 0) {
+        qCritical("Unable to open " UINPUT_PATH);
+        return false;
+    }
+
+    // Same vendor and product as the real one, so it can still be recognized
+    TouchIdentity const &identity = device->touchScreen.identity();
+    TouchAxes const &axes = device->touchScreen.axes();
+    uinput_user_dev setup;
+    memset(&setup, 0, sizeof(setup));
+    snprintf(setup.name, sizeof(setup.name), "%s", UINPUT_DEVICE_NAME);
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor = identity.id.vendor;
+    setup.id.product = identity.id.product;
+    setup.id.version = identity.id.version;
+    setup.absmax[ABS_X] = _screenSize.width() - 1;
+    setup.absmax[ABS_Y] = _screenSize.height() - 1;
+    setup.absfuzz[ABS_X] = axes.x.fuzz * _screenSize.width() / qMax(1, axes.x.span());
+    setup.absfuzz[ABS_Y] = axes.y.fuzz * _screenSize.height() / qMax(1, axes.y.span());
+
+    if (ioctl(fd, UI_SET_EVBIT, EV_SYN) < 0 ||
+        ioctl(fd, UI_SET_EVBIT, EV_KEY) < 0 ||
+        ioctl(fd, UI_SET_KEYBIT, BTN_TOUCH) < 0 ||
+        ioctl(fd, UI_SET_EVBIT, EV_ABS) < 0 ||
+        ioctl(fd, UI_SET_ABSBIT, ABS_X) < 0 ||
+        ioctl(fd, UI_SET_ABSBIT, ABS_Y) < 0 ||
+        ioctl(fd, UI_SET_PROPBIT, INPUT_PROP_DIRECT) < 0 ||
+        ::write(fd, &setup, sizeof(setup)) != static_cast<ssize_t>(sizeof(setup)) ||
+        ioctl(fd, UI_DEV_CREATE) < 0) {
+        qCritical("Unable to create the virtual touchscreen for %s", device->touchScreen.path().toUtf8().constData());
+        ::close(fd);
+        return false;
+    }
+
+    device->uinputFd = fd;
+    return true;
+}
+
+/**
+ * @brief Passes whatever a touchscreen has for us on to its virtual touchscreen
+ * @param device The touchscreen
+ * @return False if the touchscreen has gone away
+ */
+bool UinputFilter::readDevice(FilterDevice *device)
+{
+    EventReader &reader = device->touchScreen.eventReader();
+    TouchDecoder &decoder = device->touchScreen.decoder();
+    int const width = _screenSize.width();
+    int const height = _screenSize.height();
+
+    // Every sample ends with a SYN_REPORT, so a batch never has more samples than events
+    int rawX[EVENT_BATCH_SIZE];
+    int rawY[EVENT_BATCH_SIZE];
+    FilterAction actions[EVENT_BATCH_SIZE];
+    qint32 screenX[EVENT_BATCH_SIZE];
+    qint32 screenY[EVENT_BATCH_SIZE];
+    input_event out[EVENT_BATCH_SIZE * FILTER_EVENTS_PER_SAMPLE];
+
+    reader.beginWakeup();
+    int count;
+    while ((count = reader.readBatch(device->touchScreen.fd())) > 0) {
+        input_event const *events = reader.events();
+        int samples = 0;
+        for (int i = 0; i < count; i++) {
+            if (!decoder.processEvent(events[i])) {
+                continue;
+            }
+            TouchSample const &sample = decoder.sample();
+            FilterAction const action = filterSample(device, sample, _gate);
+            if (action != DropSample) {
+                rawX[samples] = sample.xy.x();
+                rawY[samples] = sample.xy.y();
+                actions[samples] = action;
+                samples++;
+            }
+        }
+
+        // Map the whole batch at once, then send it all in one write
+        device->transform.transformFixed(rawX, rawY, samples, screenX, screenY);
+        int n = 0;
+        for (int i = 0; i < samples; i++) {
+            if (actions[i] == ReleaseSample) {
+                setEvent(out[n++], EV_KEY, BTN_TOUCH, 0);
+            } else {
+                setEvent(out[n++], EV_ABS, ABS_X, toPixel(screenX[i], width));
+                setEvent(out[n++], EV_ABS, ABS_Y, toPixel(screenY[i], height));
+                if (actions[i] == PressSample) {
+                    setEvent(out[n++], EV_KEY, BTN_TOUCH, 1);
+                }
+            }
+            setEvent(out[n++], EV_SYN, SYN_REPORT, 0);
+        }
+        if (n > 0) {
+            ssize_t const bytes = static_cast<ssize_t>(n * sizeof(input_event));
+            if (::write(device->uinputFd, out, bytes) != bytes) {
+                device->writeErrors++;
+            }
+            device->forwarded += static_cast<unsigned long>(samples);
+        }
+
+        if (count < EVENT_BATCH_SIZE) {
+            break;
+        }
+    }
+    int const error = errno;
+    reader.endWakeup();
+    return !(count < 0 && error == ENODEV);
+}
+
+/**
+ * @brief Finds the size of the screen without going through X
+ * @param size Filled in with the framebuffer's visible size in pixels
+ * @return True on success, false on failure
+ */
+bool UinputFilter::framebufferSize(QSize &size)
+{
+    int const fd = ::open(FRAMEBUFFER_PATH, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    fb_var_screeninfo info;
+    bool const ok = ioctl(fd, FBIOGET_VSCREENINFO, &info) >= 0 && info.xres > 0 && info.yres > 0;
+    ::close(fd);
+    if (ok) {
+        size = QSize(static_cast<int>(info.xres), static_cast<int>(info.yres));
+    }
+    return ok;
+}
+
+/**
+ * @brief Arranges for SIGINT and SIGTERM to stop the filter, and SIGHUP to reload
+ * @return True on success, false on failure
+ *
+ * The handler writes the signal to a socket that poll() is watching, so one
+ * that lands just before poll() still wakes it up instead of waiting for the
+ * next touch, with the touchscreens grabbed all the while.
+ */
+bool UinputFilter::setupSignals()
+{
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0, signalFds) < 0) {
+        qCritical("Unable to create signal socket");
+        return false;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = signalHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGINT, &action, nullptr) < 0 || sigaction(SIGTERM, &action, nullptr) < 0 ||
+        sigaction(SIGHUP, &action, nullptr) < 0) {
+        qCritical("Unable to install signal handlers");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Signal handler that passes the signal along to the poll loop
+ * @param signum The signal that arrived
+ */
+void UinputFilter::signalHandler(int signum)
+{
+    char const value = static_cast<char>(signum);
+    ssize_t result = ::write(signalFds[1], &value, sizeof(value));
+    Q_UNUSED(result);
+}
@@ -0,0 +1,76 @@
+/* Copyright (C) 2022 Doug Brown
+ *
+ * This file is part of Chumby8TSCal.
+ *
+ * Chumby8TSCal is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Chumby8TSCal is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UINPUTFILTER_H
+#define UINPUTFILTER_H
+
+#include <QSize>
+#include <QVector>
+#include "calibrator.h"
+
+/// Name of the virtual touchscreen. It's deliberately not CHUMBY_TOUCHSCREEN_NAME,
+/// so the calibration tools never mistake it for the real one.
+#define UINPUT_DEVICE_NAME              "Chumby 8 touchscreen (calibrated)"
+
+struct FilterDevice;
+
+/**
+ * @brief Background mode that re-emits calibrated touches through a uinput touchscreen
+ *
+ * The live calibration normally lives in X, so only X clients see calibrated
+ * touches. This grabs each physical touchscreen instead, runs its events
+ * through the same decoder and pressure gate as calibrating, maps them to
+ * screen pixels with the saved matrix, and sends them out through a virtual
+ * touchscreen made with /dev/uinput. Anything reading evdev directly (like
+ * framebuffer apps) then gets calibrated coordinates.
+ *
+ * Each batch of events read from a touchscreen is decoded, transformed in one
+ * pass with CalibrationTransform::transformFixed() (no floating point, for
+ * the Chumby's FPU-less processor) and written back out with a single
+ * write(), all in fixed-size buffers. The virtual touchscreen is single-touch;
+ * a multitouch panel is reduced to its primary contact, as when calibrating.
+ * Small movements are filtered by the kernel, using the physical axis fuzz
+ * scaled to pixels.
+ *
+ * SIGHUP reloads the saved calibration, for after it has changed.
+ */
+class UinputFilter
+{
+public:
+    UinputFilter(PressureGate const &gate);
+    ~UinputFilter();
+
+    int run();
+
+private:
+    Q_DISABLE_COPY(UinputFilter)
+
+    bool openDevices();
+    bool loadCalibrations();
+    bool createVirtualDevice(FilterDevice *device);
+    bool readDevice(FilterDevice *device);
+    static bool framebufferSize(QSize &size);
+    bool setupSignals();
+    static void signalHandler(int signum);
+
+    QSize _screenSize;
+    PressureGate _gate;
+    QVector<FilterDevice *> _devices;
+};
+
+#endif // UINPUTFILTER_H